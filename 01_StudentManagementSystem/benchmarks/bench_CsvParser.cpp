@@ -0,0 +1,101 @@
+#include <benchmark/benchmark.h>
+#include "CsvParser.h"
+#include <cstdio>  // for remove()
+#include <fstream>
+#include <sstream>
+
+// Write a data file with the given number of records and return its size in bytes
+static size_t writeDataFile(const std::string& path, int64_t records) {
+    std::ofstream outFile(path, std::ios::binary);
+    std::string line;
+    size_t bytes = 0;
+    for (int64_t i = 0; i < records; ++i) {
+        line = std::to_string(1000 + i) + ",Student Number " + std::to_string(i) +
+               ",student" + std::to_string(i) + "@example.com," + std::to_string(18 + i % 12);
+        for (int64_t c = 0; c < i % 5; ++c) {
+            line += ",COURSE" + std::to_string((i + c) % 40);
+        }
+        line += '\n';
+        outFile << line;
+        bytes += line.size();
+    }
+    return bytes;
+}
+
+// The getline/stringstream reader FileManager::loadStudents used before CsvParser
+static std::vector<Student> legacyParseFile(const std::string& path) {
+    std::vector<Student> students;
+    std::ifstream inFile(path);
+    std::string line;
+    while (std::getline(inFile, line)) {
+        std::stringstream ss(line);
+        std::string token;
+        std::getline(ss, token, ',');
+        int studentId = std::stoi(token);
+        std::getline(ss, token, ',');
+        std::string name = token;
+        std::getline(ss, token, ',');
+        std::string email = token;
+        std::getline(ss, token, ',');
+        int age = std::stoi(token);
+        Student student(studentId, name, email, age);
+        while (std::getline(ss, token, ',')) {
+            student.addCourse(token);
+        }
+        students.push_back(student);
+    }
+    return students;
+}
+
+static void BM_LegacyGetlineParser(benchmark::State& state) {
+    const std::string path = "bench_csv_parser.dat";
+    size_t bytes = writeDataFile(path, state.range(0));
+
+    for (auto _ : state) {
+        std::vector<Student> students = legacyParseFile(path);
+        benchmark::DoNotOptimize(students.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * bytes);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_LegacyGetlineParser)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMillisecond);
+
+static void BM_CsvParser(benchmark::State& state) {
+    const std::string path = "bench_csv_parser.dat";
+    size_t bytes = writeDataFile(path, state.range(0));
+    CsvParser parser;
+
+    for (auto _ : state) {
+        std::vector<Student> students;
+        parser.parseFile(path, students);
+        benchmark::DoNotOptimize(students.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * bytes);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_CsvParser)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMillisecond);
+
+static void BM_CsvParserParallel(benchmark::State& state) {
+    const std::string path = "bench_csv_parser.dat";
+    size_t bytes = writeDataFile(path, state.range(0));
+    CsvParser parser;
+
+    for (auto _ : state) {
+        std::vector<Student> students;
+        parser.parseFileParallel(path, static_cast<unsigned>(state.range(1)), students);
+        benchmark::DoNotOptimize(students.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * bytes);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_CsvParserParallel)
+    ->ArgsProduct({{1000000}, {1, 2, 4, 8, 16}})
+    ->ArgNames({"records", "threads"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
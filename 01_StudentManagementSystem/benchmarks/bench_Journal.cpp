@@ -0,0 +1,55 @@
+#include <benchmark/benchmark.h>
+#include "Journal.h"
+#include <cstdio>  // for remove()
+#include <memory>
+
+// One journal shared by all benchmark threads
+static std::unique_ptr<Journal> sharedJournal;
+static const std::string journalPath = "bench_journal.journal";
+
+static void setUpJournal(DurabilityPolicy::Mode mode) {
+    std::remove(journalPath.c_str());
+    sharedJournal = std::make_unique<Journal>(journalPath);
+    sharedJournal->open();
+    DurabilityPolicy policy;
+    policy.mode = mode;
+    policy.operationCount = 64;
+    policy.intervalMs = 10;
+    sharedJournal->setDurabilityPolicy(policy);
+}
+
+static void tearDownJournal(benchmark::State& state) {
+    JournalStats stats = sharedJournal->getStats();
+    state.counters["fsyncs"] = static_cast<double>(stats.syncCount);
+    state.counters["avg_batch"] = stats.averageBatchRecords();
+    state.counters["avg_commit_us"] = stats.averageCommitMicros();
+    sharedJournal.reset();
+    std::remove(journalPath.c_str());
+}
+
+// Threads record enrollments and wait for the policy; with EveryOperation,
+// concurrent threads share fsyncs through group commit
+static void BM_JournalCommit(benchmark::State& state) {
+    auto mode = static_cast<DurabilityPolicy::Mode>(state.range(0));
+    if (state.thread_index() == 0) {
+        setUpJournal(mode);
+    }
+
+    uint32_t studentId = 1000 + static_cast<uint32_t>(state.thread_index());
+    for (auto _ : state) {
+        sharedJournal->commitPerPolicy(sharedJournal->recordEnrollment(studentId, "CS101"));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        tearDownJournal(state);
+    }
+}
+BENCHMARK(BM_JournalCommit)
+    ->ArgsProduct({{static_cast<int64_t>(DurabilityPolicy::Mode::EveryOperation),
+                    static_cast<int64_t>(DurabilityPolicy::Mode::Interval),
+                    static_cast<int64_t>(DurabilityPolicy::Mode::OperationCount),
+                    static_cast<int64_t>(DurabilityPolicy::Mode::OsManaged)}})
+    ->ArgNames({"mode"})
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
@@ -0,0 +1,247 @@
+#include <benchmark/benchmark.h>
+#include "FileManager.h"
+#include "RosterGenerator.h"
+#include "StudentManager.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>  // for remove()
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+// Save and load of generated data files, split into parse and insert time.
+//
+// Arguments: records, storage (0 = the working directory on local disk,
+// 1 = tmpfs), cold (1 = the file is dropped from the page cache before every
+// load) and format (0 = CSV data file, 1 = binary snapshot). The tmpfs
+// directory is SMS_BENCH_TMPFS_DIR, /dev/shm by default. SMS_BENCH_MAX_RECORDS
+// caps the record counts (default 50M); loading a file needs memory for the
+// parsed students plus the manager, roughly 500 MB per million records.
+
+static int64_t maxRecords() {
+    const char* limit = std::getenv("SMS_BENCH_MAX_RECORDS");
+    return limit ? std::max<int64_t>(10000, std::atoll(limit)) : 50000000;
+}
+
+static std::vector<int64_t> recordCounts() {
+    std::vector<int64_t> counts;
+    for (int64_t records : {10000, 100000, 1000000, 10000000, 50000000}) {
+        if (records <= maxRecords()) {
+            counts.push_back(records);
+        }
+    }
+    return counts;
+}
+
+static void loadArgs(benchmark::internal::Benchmark* bench) {
+    bench->ArgsProduct({recordCounts(), {0, 1}, {0, 1}, {0, 1}});
+    bench->ArgNames({"records", "tmpfs", "cold", "format"});
+}
+
+static void saveArgs(benchmark::internal::Benchmark* bench) {
+    bench->ArgsProduct({recordCounts(), {0, 1}, {0, 1}});
+    bench->ArgNames({"records", "tmpfs", "format"});
+}
+
+static std::string storageDirectory(int64_t storage) {
+    if (storage == 0) {
+        return ".";
+    }
+    const char* dir = std::getenv("SMS_BENCH_TMPFS_DIR");
+    return dir ? dir : "/dev/shm";
+}
+
+static size_t fileSize(const std::string& path) {
+    std::error_code error;
+    auto size = std::filesystem::file_size(path, error);
+    return error ? 0 : static_cast<size_t>(size);
+}
+
+// Drop a file from the page cache, so the next read comes from the device.
+// No effect on tmpfs, whose pages are the file itself.
+static bool dropFromPageCache(const std::string& path) {
+#if defined(__linux__)
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    // Only clean pages can be dropped
+    ::fdatasync(fd);
+    int result = ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    ::close(fd);
+    return result == 0;
+#else
+    (void)path;
+    return false;
+#endif
+}
+
+// Reset the peak resident set size reported as VmHWM. Memory freed by
+// earlier benchmarks is handed back first, or it would count as resident.
+static void resetPeakRss() {
+#if defined(__GLIBC__)
+    ::malloc_trim(0);
+#endif
+#if defined(__linux__)
+    std::ofstream("/proc/self/clear_refs") << "5";
+#endif
+}
+
+// Peak resident set size since the last resetPeakRss(), 0 where unknown
+static double peakRssMB() {
+#if defined(__linux__)
+    std::ifstream status("/proc/self/status");
+    std::string key;
+    while (status >> key) {
+        if (key == "VmHWM:") {
+            double kilobytes = 0;
+            status >> kilobytes;
+            return kilobytes / 1024.0;
+        }
+        status.ignore(256, '\n');
+    }
+#endif
+    return 0;
+}
+
+// Write a roster as a CSV data file without holding it in memory
+static void writeRosterCsv(const std::string& path, int64_t records) {
+    RosterOptions options;
+    options.records = static_cast<uint64_t>(records);
+    RosterGenerator(options).writeFile(path, std::max(1u, std::thread::hardware_concurrency()));
+}
+
+static void removeDataFiles(const std::string& path) {
+    std::remove(path.c_str());
+    std::remove((path + ".snap").c_str());
+}
+
+// The generated file of the last load benchmark, reused while the arguments only differ in "cold"
+struct GeneratedFile {
+    std::string path;
+    int64_t records = -1;
+    int64_t storage = -1;
+    int64_t format = -1;
+
+    ~GeneratedFile() {
+        if (!path.empty()) {
+            removeDataFiles(path);
+        }
+    }
+};
+
+static GeneratedFile generated;
+
+// Make sure a data file with the requested records exists and return the path of the file to load
+static std::string prepareDataFile(int64_t records, int64_t storage, int64_t format) {
+    if (generated.records != records || generated.storage != storage || generated.format != format) {
+        if (!generated.path.empty()) {
+            removeDataFiles(generated.path);
+        }
+        generated.path = storageDirectory(storage) + "/bench_persistence.csv";
+        writeRosterCsv(generated.path, records);
+        if (format == 1) {
+            FileManager fileManager(generated.path);
+            fileManager.saveSnapshot(fileManager.loadStudents());
+            std::remove(generated.path.c_str());
+        }
+        generated.records = records;
+        generated.storage = storage;
+        generated.format = format;
+    }
+    return format == 1 ? generated.path + ".snap" : generated.path;
+}
+
+// What loadData() does: parse the file into students, then bulk load them into a manager
+static void BM_LoadData(benchmark::State& state) {
+    const int64_t records = state.range(0);
+    const bool cold = state.range(2) != 0;
+    const bool snapshot = state.range(3) != 0;
+    if (state.range(1) && !std::filesystem::is_directory(storageDirectory(1))) {
+        state.SkipWithError("no tmpfs directory, set SMS_BENCH_TMPFS_DIR");
+        return;
+    }
+    const std::string path = prepareDataFile(records, state.range(1), state.range(3));
+    const size_t bytes = fileSize(path);
+    if (cold && !dropFromPageCache(path)) {
+        state.SkipWithError("unable to drop the file from the page cache");
+        return;
+    }
+    FileManager fileManager(generated.path);
+
+    double parseSeconds = 0;
+    double insertSeconds = 0;
+    resetPeakRss();
+    for (auto _ : state) {
+        state.PauseTiming();
+        if (cold) {
+            dropFromPageCache(path);
+        }
+        auto manager = std::make_unique<StudentManager>();
+        state.ResumeTiming();
+
+        auto started = std::chrono::steady_clock::now();
+        std::vector<Student> students = snapshot ? fileManager.loadSnapshot() : fileManager.loadStudents();
+        auto parsed = std::chrono::steady_clock::now();
+        manager->bulkLoadStudents(std::move(students));
+        auto inserted = std::chrono::steady_clock::now();
+
+        parseSeconds += std::chrono::duration<double>(parsed - started).count();
+        insertSeconds += std::chrono::duration<double>(inserted - parsed).count();
+        benchmark::DoNotOptimize(manager->getStudentCount());
+
+        state.PauseTiming();
+        manager.reset();
+        state.ResumeTiming();
+    }
+
+    state.SetBytesProcessed(state.iterations() * bytes);
+    state.SetItemsProcessed(state.iterations() * records);
+    state.counters["parseMs"] = benchmark::Counter(parseSeconds * 1000, benchmark::Counter::kAvgIterations);
+    state.counters["insertMs"] = benchmark::Counter(insertSeconds * 1000, benchmark::Counter::kAvgIterations);
+    state.counters["peakRssMB"] = peakRssMB();
+}
+BENCHMARK(BM_LoadData)->Apply(loadArgs)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+// What saveData() does: stream every student of a manager to the data file or snapshot
+static void BM_SaveData(benchmark::State& state) {
+    const int64_t records = state.range(0);
+    const bool snapshot = state.range(2) != 0;
+    if (state.range(1) && !std::filesystem::is_directory(storageDirectory(1))) {
+        state.SkipWithError("no tmpfs directory, set SMS_BENCH_TMPFS_DIR");
+        return;
+    }
+    StudentManager manager;
+    const std::string path = storageDirectory(state.range(1)) + "/bench_persistence_save.csv";
+    {
+        writeRosterCsv(path, records);
+        FileManager source(path);
+        manager.bulkLoadStudents(source.loadStudents());
+    }
+    FileManager fileManager(path);
+
+    resetPeakRss();
+    for (auto _ : state) {
+        bool saved = snapshot ? fileManager.saveSnapshot(manager) : fileManager.saveStudents(manager);
+        benchmark::DoNotOptimize(saved);
+    }
+
+    const size_t bytes = fileSize(snapshot ? path + ".snap" : path);
+    state.SetBytesProcessed(state.iterations() * bytes);
+    state.SetItemsProcessed(state.iterations() * records);
+    state.counters["peakRssMB"] = peakRssMB();
+    removeDataFiles(path);
+}
+BENCHMARK(BM_SaveData)->Apply(saveArgs)->UseRealTime()->Unit(benchmark::kMillisecond);
@@ -0,0 +1,110 @@
+#include <benchmark/benchmark.h>
+#include "ShardedStudentManager.h"
+#include <fstream>
+#include <string>
+#include <vector>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+static const int64_t PRELOADED = 100000;
+static const char* COURSES[] = {"Math", "Physics", "Chemistry", "Biology", "History", "Art", "Music", "Latin"};
+
+static std::vector<Student> makeStudents(int64_t count) {
+    std::vector<Student> students;
+    students.reserve(static_cast<size_t>(count));
+    for (int64_t i = 0; i < count; ++i) {
+        students.emplace_back(static_cast<int>(1000 + i), "Student " + std::to_string(i), "s@example.com", 20);
+    }
+    return students;
+}
+
+// Registration workload: add a student and enroll an existing one in a course.
+// Thread t enrolls IDs 1000 + t, 1000 + t + threads, ... like a worker pool
+// partitioned by ID.
+template <typename Manager>
+static void registerStudents(benchmark::State& state, Manager& manager) {
+    const uint32_t stride = static_cast<uint32_t>(state.threads());
+    uint32_t offset = static_cast<uint32_t>(state.thread_index());
+    uint32_t course = offset;
+
+    for (auto _ : state) {
+        manager.addStudent("Registered Student", "r@example.com", 20);
+        manager.enrollStudentInCourse(1000 + offset, COURSES[course++ % 8]);
+        offset = (offset + stride) % PRELOADED;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// One manager shared by all benchmark threads, built before they start
+static StudentManager* plainManager = nullptr;
+static ShardedStudentManager* shardedManager = nullptr;
+
+static void setupPlain(const benchmark::State&) {
+    plainManager = new StudentManager();
+    plainManager->bulkLoadStudents(makeStudents(PRELOADED));
+}
+
+static void teardownPlain(const benchmark::State&) {
+    delete plainManager;
+    plainManager = nullptr;
+}
+
+static void BM_RegisterPlain(benchmark::State& state) {
+    registerStudents(state, *plainManager);
+}
+BENCHMARK(BM_RegisterPlain)->Setup(setupPlain)->Teardown(teardownPlain)->ThreadRange(1, 8)->UseRealTime();
+
+// The same workload on one shard per benchmark thread
+static void setupSharded(const benchmark::State& state) {
+    shardedManager = new ShardedStudentManager(static_cast<size_t>(state.threads()));
+    shardedManager->bulkLoadStudents(makeStudents(PRELOADED));
+}
+
+static void teardownSharded(const benchmark::State&) {
+    delete shardedManager;
+    shardedManager = nullptr;
+}
+
+static void BM_RegisterSharded(benchmark::State& state) {
+    registerStudents(state, *shardedManager);
+}
+BENCHMARK(BM_RegisterSharded)->Setup(setupSharded)->Teardown(teardownSharded)->ThreadRange(1, 8)->UseRealTime();
+
+// Current resident set size, 0 where unknown
+static double rssMB() {
+#if defined(__linux__)
+    std::ifstream status("/proc/self/status");
+    std::string key;
+    while (status >> key) {
+        if (key == "VmRSS:") {
+            double kilobytes = 0;
+            status >> kilobytes;
+            return kilobytes / 1024.0;
+        }
+        status.ignore(256, '\n');
+    }
+#endif
+    return 0;
+}
+
+// Memory of a sharded manager filled by addStudent(), by shard count. Every
+// shard holds every n-th ID; rssMB should stay flat as the shard count grows.
+static void BM_ShardedMemory(benchmark::State& state) {
+    const int64_t students = 400000;
+    for (auto _ : state) {
+#if defined(__GLIBC__)
+        malloc_trim(0);
+#endif
+        double before = rssMB();
+        ShardedStudentManager manager(static_cast<size_t>(state.range(0)));
+        for (int64_t i = 0; i < students; ++i) {
+            manager.addStudent("Student " + std::to_string(i), "s@example.com", 20);
+        }
+        double used = rssMB() - before;
+        state.counters["rssMB"] = used;
+        state.counters["bytesPerStudent"] = used * 1024 * 1024 / students;
+    }
+}
+BENCHMARK(BM_ShardedMemory)->Arg(1)->Arg(8)->Arg(16)->Iterations(1)->Unit(benchmark::kMillisecond);
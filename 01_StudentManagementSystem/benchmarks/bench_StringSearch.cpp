@@ -0,0 +1,99 @@
+#include <benchmark/benchmark.h>
+#include "StringSearch.h"
+#include <algorithm>
+#include <cctype>
+#include <string>
+#include <vector>
+
+// The search StudentManager used before: lowercase copies and std::string::find
+static bool legacyContains(std::string text, std::string pattern) {
+    std::transform(text.begin(), text.end(), text.begin(), ::tolower);
+    std::transform(pattern.begin(), pattern.end(), pattern.begin(), ::tolower);
+    return text.find(pattern) != std::string::npos;
+}
+
+// Typical roster names; most do not contain the query
+static std::vector<std::string> makeNames() {
+    static const char* first[] = {"John", "Jane", "Alice", "Robert", "Maria", "Christopher", "Li", "Fatima"};
+    static const char* last[] = {"Smith", "Johnson", "Garcia", "Williams", "Nakamura", "O'Brien", "Kowalski"};
+    std::vector<std::string> names;
+    for (int i = 0; i < 4096; ++i) {
+        names.push_back(std::string(first[i % 8]) + " " + last[(i / 8) % 7]);
+    }
+    return names;
+}
+
+static void BM_LegacyNameMatch(benchmark::State& state) {
+    std::vector<std::string> names = makeNames();
+    for (auto _ : state) {
+        size_t matches = 0;
+        for (const auto& name : names) {
+            matches += legacyContains(name, "KOWAL");
+        }
+        benchmark::DoNotOptimize(matches);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(names.size()));
+}
+BENCHMARK(BM_LegacyNameMatch);
+
+static void BM_KernelNameMatch(benchmark::State& state) {
+    StringSearchKernel kernel = static_cast<StringSearchKernel>(state.range(0));
+    if (!isStringSearchKernelSupported(kernel)) {
+        state.SkipWithError("Kernel not supported on this CPU");
+        return;
+    }
+    std::vector<std::string> names = makeNames();
+    for (auto _ : state) {
+        size_t matches = 0;
+        for (const auto& name : names) {
+            matches += containsIgnoreCase(name, "KOWAL", kernel);
+        }
+        benchmark::DoNotOptimize(matches);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(names.size()));
+}
+BENCHMARK(BM_KernelNameMatch)->ArgName("kernel")->DenseRange(0, 2);
+
+// Long text where nearly every position starts a partial match
+static void BM_LegacyPathological(benchmark::State& state) {
+    std::string text(static_cast<size_t>(state.range(0)), 'a');
+    std::string pattern = std::string(16, 'A') + "b";
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(legacyContains(text, pattern));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LegacyPathological)->Arg(1 << 16);
+
+static void BM_KernelPathological(benchmark::State& state) {
+    StringSearchKernel kernel = static_cast<StringSearchKernel>(state.range(1));
+    if (!isStringSearchKernelSupported(kernel)) {
+        state.SkipWithError("Kernel not supported on this CPU");
+        return;
+    }
+    std::string text(static_cast<size_t>(state.range(0)), 'a');
+    std::string pattern = std::string(16, 'A') + "b";
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(containsIgnoreCase(text, pattern, kernel));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_KernelPathological)->ArgNames({"bytes", "kernel"})->Args({1 << 16, 0})->Args({1 << 16, 1})->Args({1 << 16, 2});
+
+// Long text with no candidate positions, the case the SIMD filter is built for
+static void BM_KernelLongMiss(benchmark::State& state) {
+    StringSearchKernel kernel = static_cast<StringSearchKernel>(state.range(1));
+    if (!isStringSearchKernelSupported(kernel)) {
+        state.SkipWithError("Kernel not supported on this CPU");
+        return;
+    }
+    std::string text;
+    while (text.size() < static_cast<size_t>(state.range(0))) {
+        text += "Lorem ipsum dolor sit amet ";
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(containsIgnoreCase(text, "QUIZ", kernel));
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+BENCHMARK(BM_KernelLongMiss)->ArgNames({"bytes", "kernel"})->Args({1 << 16, 0})->Args({1 << 16, 1})->Args({1 << 16, 2});
@@ -0,0 +1,496 @@
+#include <benchmark/benchmark.h>
+#include "FileManager.h"
+#include "StudentManager.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+static const char* FIRST_NAMES[] = {"James", "Mary", "Robert", "Patricia", "John", "Jennifer",
+                                    "Michael", "Linda", "David", "Elizabeth", "William", "Barbara",
+                                    "Richard", "Susan", "Joseph", "Jessica", "Thomas", "Sarah",
+                                    "Charles", "Karen", "Wei", "Yuki", "Olga", "Ahmed"};
+static const char* LAST_NAMES[] = {"Smith", "Johnson", "Williams", "Brown", "Jones", "Garcia",
+                                   "Miller", "Davis", "Rodriguez", "Martinez", "Hernandez",
+                                   "Lopez", "Gonzalez", "Wilson", "Anderson", "Thomas", "Taylor",
+                                   "Moore", "Jackson", "Martin", "Lee", "Perez", "Thompson"};
+
+// Deterministic "First Last-N" names, so longer queries select few students
+static std::string makeName(int64_t i) {
+    return std::string(FIRST_NAMES[i % 24]) + " " + LAST_NAMES[(i / 24) % 23] + "-" +
+           std::to_string(i % 9973);
+}
+
+static std::vector<Student> makeStudents(int64_t count) {
+    std::vector<Student> students;
+    students.reserve(static_cast<size_t>(count));
+    for (int64_t i = 0; i < count; ++i) {
+        students.emplace_back(static_cast<int>(1000 + i), makeName(i), "s@example.com", 20);
+    }
+    return students;
+}
+
+// The full-scan search StudentManager::searchStudentsByName used before the trigram index
+static std::vector<const Student*> legacySearch(const std::map<uint32_t, Student>& students,
+                                                const std::string& name) {
+    std::vector<const Student*> result;
+    for (auto& pair : students) {
+        std::string studentName = pair.second.getName();
+        std::string searchName = name;
+        std::transform(studentName.begin(), studentName.end(), studentName.begin(), ::tolower);
+        std::transform(searchName.begin(), searchName.end(), searchName.begin(), ::tolower);
+        if (studentName.find(searchName) != std::string::npos) {
+            result.push_back(&pair.second);
+        }
+    }
+    return result;
+}
+
+static void BM_LegacyScanSearch(benchmark::State& state) {
+    std::map<uint32_t, Student> students;
+    for (auto& student : makeStudents(state.range(0))) {
+        students.emplace(static_cast<uint32_t>(student.getStudentId()), std::move(student));
+    }
+
+    for (auto _ : state) {
+        auto result = legacySearch(students, "olga lee-12");
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LegacyScanSearch)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMillisecond);
+
+static void BM_IndexedSearch(benchmark::State& state) {
+    StudentManager manager;
+    manager.bulkLoadStudents(makeStudents(state.range(0)));
+
+    for (auto _ : state) {
+        auto result = manager.searchStudentsByName("olga lee-12");
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_IndexedSearch)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMicrosecond);
+
+// Queries shorter than a trigram still scan every student
+static void BM_ShortQuerySearch(benchmark::State& state) {
+    StudentManager manager;
+    manager.bulkLoadStudents(makeStudents(state.range(0)));
+
+    for (auto _ : state) {
+        auto result = manager.searchStudentsByName("yu");
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ShortQuerySearch)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMillisecond);
+
+// Type-ahead: the first ten names starting with a common prefix
+static void BM_PrefixSearch(benchmark::State& state) {
+    StudentManager manager;
+    manager.bulkLoadStudents(makeStudents(state.range(0)));
+
+    for (auto _ : state) {
+        auto result = manager.searchStudentsByNamePrefix("jo", 10);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PrefixSearch)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMicrosecond);
+
+// Age range filter over Student objects (range(1) == 0) or the columnar copy (== 1)
+static void BM_AgeRangeFilter(benchmark::State& state) {
+    StudentManager manager;
+    std::vector<Student> students = makeStudents(state.range(0));
+    for (size_t i = 0; i < students.size(); ++i) {
+        students[i] = Student(students[i].getStudentId(), students[i].getName(), "s@example.com",
+                              17 + static_cast<int>(i % 40));
+    }
+    manager.bulkLoadStudents(std::move(students));
+    manager.setColumnarStoreEnabled(state.range(1) != 0);
+
+    for (auto _ : state) {
+        auto result = manager.findStudentIdsByAgeRange(20, 24);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AgeRangeFilter)
+    ->ArgsProduct({{100000, 1000000}, {0, 1}})
+    ->ArgNames({"students", "columnar"})
+    ->Unit(benchmark::kMillisecond);
+
+// Students spread over 200 courses with 3 enrollments each
+static void loadEnrolledStudents(StudentManager& manager, int64_t count) {
+    std::vector<Student> students = makeStudents(count);
+    for (size_t i = 0; i < students.size(); ++i) {
+        for (size_t k = 0; k < 3; ++k) {
+            students[i].addCourse("COURSE" + std::to_string((i * 7 + k * 61) % 200));
+        }
+    }
+    manager.bulkLoadStudents(std::move(students));
+}
+
+// The course roster report before the course index: copy everyone and filter
+static void BM_CourseRosterScan(benchmark::State& state) {
+    StudentManager manager;
+    loadEnrolledStudents(manager, state.range(0));
+
+    for (auto _ : state) {
+        std::vector<Student> roster;
+        for (auto& student : manager.getAllStudents()) {
+            if (student.isEnrolledIn("COURSE42")) {
+                roster.push_back(std::move(student));
+            }
+        }
+        benchmark::DoNotOptimize(roster.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CourseRosterScan)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+static void BM_CourseRosterIndexed(benchmark::State& state) {
+    StudentManager manager;
+    loadEnrolledStudents(manager, state.range(0));
+
+    for (auto _ : state) {
+        auto roster = manager.getStudentsInCourse("COURSE42");
+        benchmark::DoNotOptimize(roster.data());
+        benchmark::DoNotOptimize(manager.getCourseEnrollmentCount("COURSE42"));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CourseRosterIndexed)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+// "In COURSE1 and COURSE2 but not COURSE3" by checking every student
+static void BM_CourseQueryScan(benchmark::State& state) {
+    StudentManager manager;
+    loadEnrolledStudents(manager, state.range(0));
+
+    for (auto _ : state) {
+        std::vector<uint32_t> result;
+        for (const auto& student : manager.getAllStudents()) {
+            if (student.isEnrolledIn("COURSE1") && student.isEnrolledIn("COURSE62") &&
+                !student.isEnrolledIn("COURSE3")) {
+                result.push_back(static_cast<uint32_t>(student.getStudentId()));
+            }
+        }
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CourseQueryScan)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+static void BM_CourseQueryBitmap(benchmark::State& state) {
+    StudentManager manager;
+    loadEnrolledStudents(manager, state.range(0));
+    CourseQuery query;
+    query.allOf = {"COURSE1", "COURSE62"};
+    query.noneOf = {"COURSE3"};
+
+    for (auto _ : state) {
+        auto result = manager.findStudentIdsByCourses(query);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CourseQueryBitmap)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+
+// Students in any of 20 courses, counted
+static void BM_CourseQueryAnyOf20(benchmark::State& state) {
+    StudentManager manager;
+    loadEnrolledStudents(manager, state.range(0));
+    CourseQuery query;
+    for (int i = 0; i < 20; ++i) {
+        query.anyOf.push_back("COURSE" + std::to_string(i * 10));
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(manager.countStudentsByCourses(query));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CourseQueryAnyOf20)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+
+// Saving 100k students: copy them out with getAllStudents() or stream them in place
+static void BM_SaveStudents(benchmark::State& state) {
+    StudentManager manager;
+    loadEnrolledStudents(manager, 100000);
+    FileManager fileManager("bench_save_students.csv");
+
+    for (auto _ : state) {
+        bool saved = state.range(0) ? fileManager.saveStudents(manager)
+                                    : fileManager.saveStudents(manager.getAllStudents());
+        benchmark::DoNotOptimize(saved);
+    }
+    state.SetItemsProcessed(state.iterations() * 100000);
+    std::remove("bench_save_students.csv");
+}
+BENCHMARK(BM_SaveStudents)->ArgName("inPlace")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+// Read QPS of one shared manager as reader threads are added; reads share the lock
+static StudentManager* sharedManager = nullptr;
+
+static void BM_ConcurrentReads(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        sharedManager = new StudentManager();
+        sharedManager->bulkLoadStudents(makeStudents(100000));
+    }
+    uint32_t id = 1000 + static_cast<uint32_t>(state.thread_index()) * 7919;
+
+    for (auto _ : state) {
+        id = 1000 + (id * 31 + 17) % 100000;
+        benchmark::DoNotOptimize(sharedManager->findStudent(id));
+        benchmark::DoNotOptimize(sharedManager->getStudentCount());
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        delete sharedManager;
+        sharedManager = nullptr;
+    }
+}
+BENCHMARK(BM_ConcurrentReads)->ThreadRange(1, 8)->UseRealTime();
+
+// Writes while a background thread keeps scanning all students: without
+// snapshots each scan holds the lock and a write can wait for a whole scan,
+// with them scans walk a snapshot and writes pay for path copying instead
+static void BM_WritesDuringScan(benchmark::State& state) {
+    StudentManager manager;
+    manager.bulkLoadStudents(makeStudents(200000));
+    manager.setSnapshotsEnabled(state.range(0) != 0);
+
+    std::atomic<bool> stop(false);
+    std::thread scanner([&manager, &stop] {
+        while (!stop.load()) {
+            size_t ages = 0;
+            manager.forEachStudent([&ages](const Student& student) { ages += student.getAge(); });
+            benchmark::DoNotOptimize(ages);
+        }
+    });
+
+    uint32_t id = 1000;
+    std::chrono::steady_clock::duration slowest{};
+    for (auto _ : state) {
+        auto start = std::chrono::steady_clock::now();
+        manager.enrollStudentInCourse(id, "Math");
+        slowest = std::max(slowest, std::chrono::steady_clock::now() - start);
+        id = id < 200999 ? id + 1 : 1000;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["maxWriteUs"] = std::chrono::duration<double, std::micro>(slowest).count();
+
+    stop.store(true);
+    scanner.join();
+}
+BENCHMARK(BM_WritesDuringScan)->ArgName("snapshots")->Arg(0)->Arg(1)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+// ---------------------------------------------------------------------------
+// Hot paths over roster sizes (1K to 10M students) and courses per student.
+// Every benchmark leaves the shared roster as it found it.
+
+// Largest roster to run; SMS_BENCH_MAX_STUDENTS lowers it on small machines
+static int64_t maxRosterSize() {
+    const char* limit = std::getenv("SMS_BENCH_MAX_STUDENTS");
+    return limit ? std::max<int64_t>(1000, std::atoll(limit)) : 10000000;
+}
+
+static void rosterArgs(benchmark::internal::Benchmark* bench) {
+    bench->ArgNames({"students", "courses"});
+    for (int64_t students = 1000; students <= maxRosterSize(); students *= 10) {
+        for (int64_t courses : {1, 8}) {
+            bench->Args({students, courses});
+        }
+    }
+}
+
+// Student i of a roster, enrolled in courses of a 200-course catalogue
+static Student makeRosterStudent(int64_t i, int64_t courses) {
+    Student student(static_cast<int>(1000 + i), makeName(i), "s@example.com", 20);
+    for (int64_t k = 0; k < courses; ++k) {
+        student.addCourse("COURSE" + std::to_string((i * 7 + k * 61) % 200));
+    }
+    return student;
+}
+
+// Building the large rosters dominates the run, so the last one is kept for the next benchmark
+static StudentManager& cachedRoster(int64_t students, int64_t courses) {
+    static std::unique_ptr<StudentManager> roster;
+    static std::pair<int64_t, int64_t> built(0, 0);
+    if (!roster || built != std::make_pair(students, courses)) {
+        roster.reset();
+        roster = std::make_unique<StudentManager>();
+        std::vector<Student> batch;
+        batch.reserve(static_cast<size_t>(students));
+        for (int64_t i = 0; i < students; ++i) {
+            batch.push_back(makeRosterStudent(i, courses));
+        }
+        roster->bulkLoadStudents(std::move(batch));
+        built = std::make_pair(students, courses);
+    }
+    return *roster;
+}
+
+// Visits every roster ID once in a scattered order (7919 is prime and no roster size divides it)
+static uint32_t scatteredId(uint64_t step, int64_t students) {
+    return static_cast<uint32_t>(1000 + (step * 7919) % static_cast<uint64_t>(students));
+}
+
+// Puts deleted roster students back
+static void restoreStudents(StudentManager& manager, std::vector<uint32_t>& ids, int64_t courses) {
+    std::vector<Student> batch;
+    for (uint32_t id : ids) {
+        batch.push_back(makeRosterStudent(id - 1000, courses));
+    }
+    manager.bulkLoadStudents(std::move(batch));
+    ids.clear();
+}
+
+// Mutations are undone in untimed batches, small enough never to touch a student twice
+static int64_t undoBatch(int64_t students) {
+    return std::min<int64_t>(students / 2, 1024);
+}
+
+static void BM_AddStudent(benchmark::State& state) {
+    const int64_t students = state.range(0);
+    StudentManager& manager = cachedRoster(students, state.range(1));
+    std::vector<std::string> names;
+    for (int64_t i = 0; i < 1024; ++i) {
+        names.push_back(makeName(students + i));
+    }
+
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(manager.addStudent(names[i++ & 1023], "new@example.com", 21));
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    for (uint32_t id : manager.findStudentIdsByIdRange(static_cast<uint32_t>(1000 + students), UINT32_MAX)) {
+        manager.deleteStudent(id);
+    }
+}
+BENCHMARK(BM_AddStudent)->Apply(rosterArgs);
+
+static void BM_GetStudent(benchmark::State& state) {
+    const int64_t students = state.range(0);
+    StudentManager& manager = cachedRoster(students, state.range(1));
+
+    uint64_t step = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(manager.getStudent(scatteredId(step++, students)));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GetStudent)->Apply(rosterArgs);
+
+static void BM_DeleteStudent(benchmark::State& state) {
+    const int64_t students = state.range(0);
+    const int64_t courses = state.range(1);
+    StudentManager& manager = cachedRoster(students, courses);
+    std::vector<uint32_t> deleted;
+    deleted.reserve(static_cast<size_t>(undoBatch(students)));
+
+    uint64_t step = 0;
+    for (auto _ : state) {
+        uint32_t id = scatteredId(step++, students);
+        benchmark::DoNotOptimize(manager.deleteStudent(id));
+        deleted.push_back(id);
+        if (static_cast<int64_t>(deleted.size()) == undoBatch(students)) {
+            state.PauseTiming();
+            restoreStudents(manager, deleted, courses);
+            state.ResumeTiming();
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+    restoreStudents(manager, deleted, courses);
+}
+BENCHMARK(BM_DeleteStudent)->Apply(rosterArgs);
+
+// Exact full names of roster students; each query matches a handful of students
+static void BM_SearchStudentsByName(benchmark::State& state) {
+    const int64_t students = state.range(0);
+    StudentManager& manager = cachedRoster(students, state.range(1));
+    std::vector<std::string> queries;
+    for (uint64_t step = 0; step < 64; ++step) {
+        queries.push_back(makeName(scatteredId(step, students) - 1000));
+    }
+
+    size_t i = 0;
+    for (auto _ : state) {
+        auto result = manager.searchStudentsByName(queries[i++ & 63]);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SearchStudentsByName)->Apply(rosterArgs);
+
+static void BM_EnrollStudentInCourse(benchmark::State& state) {
+    const int64_t students = state.range(0);
+    StudentManager& manager = cachedRoster(students, state.range(1));
+    std::vector<uint32_t> enrolled;
+    enrolled.reserve(static_cast<size_t>(undoBatch(students)));
+
+    uint64_t step = 0;
+    for (auto _ : state) {
+        uint32_t id = scatteredId(step++, students);
+        benchmark::DoNotOptimize(manager.enrollStudentInCourse(id, "BENCH101"));
+        enrolled.push_back(id);
+        if (static_cast<int64_t>(enrolled.size()) == undoBatch(students)) {
+            state.PauseTiming();
+            for (uint32_t undo : enrolled) {
+                manager.removeStudentFromCourse(undo, "BENCH101");
+            }
+            enrolled.clear();
+            state.ResumeTiming();
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+    for (uint32_t undo : enrolled) {
+        manager.removeStudentFromCourse(undo, "BENCH101");
+    }
+}
+BENCHMARK(BM_EnrollStudentInCourse)->Apply(rosterArgs);
+
+// Half of the checked courses are ones the student takes
+static void BM_IsEnrolledIn(benchmark::State& state) {
+    const int64_t students = state.range(0);
+    const int64_t courses = state.range(1);
+    StudentManager& manager = cachedRoster(students, courses);
+    std::vector<const Student*> picked;
+    std::vector<std::string> checked;
+    for (uint64_t step = 0; step < 1024; ++step) {
+        uint32_t id = scatteredId(step, students);
+        picked.push_back(manager.getStudent(id));
+        int64_t i = id - 1000;
+        int64_t k = static_cast<int64_t>(step) % courses;
+        // COURSE200 and up are outside the catalogue
+        int64_t course = (step % 2) ? (i * 7 + k * 61) % 200 : 200 + (i + k) % 200;
+        checked.push_back("COURSE" + std::to_string(course));
+    }
+
+    size_t i = 0;
+    for (auto _ : state) {
+        size_t slot = i++ & 1023;
+        benchmark::DoNotOptimize(picked[slot]->isEnrolledIn(checked[slot]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_IsEnrolledIn)->Apply(rosterArgs);
+
+static void BM_GetAllStudents(benchmark::State& state) {
+    const int64_t students = state.range(0);
+    StudentManager& manager = cachedRoster(students, state.range(1));
+
+    for (auto _ : state) {
+        auto all = manager.getAllStudents();
+        benchmark::DoNotOptimize(all.data());
+    }
+    state.SetItemsProcessed(state.iterations() * students);
+}
+BENCHMARK(BM_GetAllStudents)->Apply(rosterArgs)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+#include "StudentStore.h"
+#include <random>
+#include <vector>
+
+// Fill a store with consecutive IDs from 1000, the way StudentManager assigns them
+template <typename Store>
+static void fillStore(Store& store, int64_t count) {
+    for (int64_t i = 0; i < count; ++i) {
+        uint32_t id = static_cast<uint32_t>(1000 + i);
+        store.insertOrAssign(id, Student(static_cast<int>(id), "Student Name", "s@example.com", 20));
+    }
+}
+
+// Random existing IDs, so lookups are not served in memory order
+static std::vector<uint32_t> randomIds(int64_t count, size_t samples) {
+    std::mt19937 rng(1);
+    std::vector<uint32_t> ids(samples);
+    for (auto& id : ids) {
+        id = static_cast<uint32_t>(1000 + rng() % count);
+    }
+    return ids;
+}
+
+template <typename Store>
+static void BM_StoreLookup(benchmark::State& state) {
+    Store store;
+    fillStore(store, state.range(0));
+    std::vector<uint32_t> ids = randomIds(state.range(0), 4096);
+
+    size_t next = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(store.find(ids[next++ & 4095]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_StoreLookup, MapStudentStore)->RangeMultiplier(10)->Range(10000, 1000000);
+BENCHMARK_TEMPLATE(BM_StoreLookup, DenseStudentStore)->RangeMultiplier(10)->Range(10000, 1000000);
+
+template <typename Store>
+static void BM_StoreInsert(benchmark::State& state) {
+    for (auto _ : state) {
+        Store store;
+        fillStore(store, state.range(0));
+        benchmark::DoNotOptimize(store.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_StoreInsert, MapStudentStore)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_StoreInsert, DenseStudentStore)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMillisecond);
+
+template <typename Store>
+static void BM_StoreDelete(benchmark::State& state) {
+    std::vector<uint32_t> ids = randomIds(state.range(0), static_cast<size_t>(state.range(0) / 2));
+    for (auto _ : state) {
+        state.PauseTiming();
+        Store store;
+        fillStore(store, state.range(0));
+        state.ResumeTiming();
+        for (uint32_t id : ids) {
+            store.erase(id);
+        }
+        benchmark::DoNotOptimize(store.size());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(ids.size()));
+}
+BENCHMARK_TEMPLATE(BM_StoreDelete, MapStudentStore)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_StoreDelete, DenseStudentStore)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMillisecond);
+
+template <typename Store>
+static void BM_StoreScan(benchmark::State& state) {
+    Store store;
+    fillStore(store, state.range(0));
+
+    for (auto _ : state) {
+        int64_t ageSum = 0;
+        store.forEach([&ageSum](const Student& student) { ageSum += student.getAge(); });
+        benchmark::DoNotOptimize(ageSum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_StoreScan, MapStudentStore)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_StoreScan, DenseStudentStore)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,21 @@
+include(FetchContent)
+
+# Prefer an installed Google Benchmark, fall back to fetching it
+find_package(benchmark QUIET)
+
+if (NOT benchmark_FOUND)
+    # Set the base directory for FetchContent to download libraries
+    set(FETCHCONTENT_BASE_DIR ${CMAKE_SOURCE_DIR}/3rd_libs)
+
+    FetchContent_Declare(
+      googlebenchmark
+      GIT_REPOSITORY https://github.com/google/benchmark.git
+      GIT_TAG v1.8.3
+    )
+
+    # Benchmark's own tests would pull in another copy of GoogleTest
+    set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+    set(BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE BOOL "" FORCE)
+
+    FetchContent_MakeAvailable(googlebenchmark)
+endif()
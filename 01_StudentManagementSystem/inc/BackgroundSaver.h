@@ -0,0 +1,97 @@
+#ifndef BACKGROUND_SAVER_H__
+#define BACKGROUND_SAVER_H__
+
+#include "FileManager.h"
+#include "StudentManager.h"
+#include <condition_variable>
+#include <cstdint>
+#include <future>
+#include <mutex>
+#include <thread>
+
+/**
+ * @class BackgroundSaver
+ * @brief Writes the students of a manager to the data file on a worker thread
+ *
+ * @details requestSave() takes a snapshot of the manager and returns at once;
+ *          the worker writes it with FileManager::saveStudents, which goes
+ *          through a temporary file and a rename. Enable snapshots on the
+ *          manager to make taking one O(1); otherwise every request copies
+ *          the students.
+ *
+ *          At most one save runs and one waits. A request made while another
+ *          one is waiting joins it: the waiting save switches to the newer
+ *          snapshot and both callers get the same future. A request made
+ *          while a save is running is never answered by that save, since the
+ *          running save may predate the caller's changes.
+ *
+ *          The destructor finishes the waiting save before it returns.
+ *          While a saver exists, the data file should only be written
+ *          through it.
+ */
+class BackgroundSaver {
+private:
+    const StudentManager& manager;  ///< Manager the snapshots are taken from
+    FileManager& fileManager;       ///< Writes the data file
+
+    StudentSnapshot queuedView;             ///< Snapshot for the waiting save
+    std::promise<bool> queuedPromise;       ///< Result of the waiting save
+    std::shared_future<bool> queuedFuture;  ///< Handed to the waiting save's callers
+    bool queued;                            ///< A save is waiting
+    bool running;                           ///< The worker is writing a save
+    uint64_t completedSaves;                ///< Saves the worker finished, successful or not
+
+    mutable std::mutex mutex;             ///< Guards all state above
+    std::condition_variable wakeup;       ///< Wakes the worker for a request or to stop
+    mutable std::condition_variable idle; ///< Signalled when the worker runs out of work
+    std::thread worker;                   ///< Writes the saves
+    bool stopWorker;                      ///< Asks the worker to exit
+
+    void workerLoop();
+
+public:
+    /**
+     * @brief Constructor
+     * @param manager Manager whose students are saved; must outlive the saver
+     * @param fileManager File manager writing the data file; must outlive the saver
+     * @details Starts the worker thread
+     */
+    BackgroundSaver(const StudentManager& manager, FileManager& fileManager);
+
+    /**
+     * @brief Destructor
+     * @details Finishes the running and the waiting save, then stops the worker
+     */
+    ~BackgroundSaver();
+
+    BackgroundSaver(const BackgroundSaver&) = delete;
+    BackgroundSaver& operator=(const BackgroundSaver&) = delete;
+
+    /**
+     * @brief Ask for the current students to be saved
+     * @return Future that becomes true once a save containing every change
+     *         made before this call is on disk, false if that save failed
+     * @details If the save throws, for example std::bad_alloc, the exception
+     *          is rethrown by the future's get()
+     */
+    std::shared_future<bool> requestSave();
+
+    /**
+     * @brief Check whether a save is running or waiting
+     * @return true if the worker has work
+     */
+    bool isSaving() const;
+
+    /**
+     * @brief Wait until no save is running or waiting
+     */
+    void waitIdle() const;
+
+    /**
+     * @brief Get the number of saves the worker finished
+     * @return Finished saves; requests that joined a waiting save count once
+     */
+    uint64_t getCompletedSaveCount() const;
+};
+
+#endif // BACKGROUND_SAVER_H__
@@ -0,0 +1,138 @@
+#ifndef COLUMNAR_STUDENT_STORE_H__
+#define COLUMNAR_STUDENT_STORE_H__
+
+#include "Student.h"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class ColumnarStudentStore
+ * @brief Structure-of-arrays copy of the students for analytic scans
+ *
+ * @details Each field lives in its own contiguous column: IDs and ages as
+ *          plain integer arrays, names and emails as offsets into one string
+ *          arena, and course lists as offsets into an array of CourseDictionary
+ *          IDs. A filter over ages or IDs therefore streams through
+ *          4-byte integers only, instead of walking Student objects and
+ *          pulling their string headers into the cache.
+ *
+ *          Rows are appended in insertion order. Deleting a student clears
+ *          its live flag; changing its courses appends a new course list.
+ *          Once more than half of the rows or course references are dead the
+ *          columns are rebuilt, sorted by ID.
+ *
+ *          Filter results are always returned in ascending ID order.
+ */
+class ColumnarStudentStore {
+private:
+    // One entry per row
+    std::vector<uint32_t> ids;            ///< Student IDs
+    std::vector<int32_t> ages;            ///< Student ages
+    std::vector<uint8_t> live;            ///< 1 for live rows, 0 for deleted ones
+    std::vector<uint64_t> nameOffsets;    ///< Name start in strings
+    std::vector<uint32_t> nameLengths;    ///< Name length
+    std::vector<uint64_t> emailOffsets;   ///< Email start in strings
+    std::vector<uint32_t> emailLengths;   ///< Email length
+    std::vector<uint64_t> courseOffsets;  ///< First entry of the course list in courseRefs
+    std::vector<uint32_t> courseCounts;   ///< Length of the course list
+
+    std::string strings;                  ///< Arena holding every name and email
+    std::vector<uint32_t> courseRefs;     ///< Course lists, as CourseDictionary IDs
+
+    std::unordered_map<uint32_t, uint32_t> rowOf;  ///< Student ID -> row
+    std::size_t deadRows;                 ///< Rows whose live flag is 0
+    std::size_t deadCourseRefs;           ///< courseRefs entries no row points to
+    bool sortedById;                      ///< Rows are in ascending ID order
+
+    void appendCourses(uint32_t row, const Student& student);
+    void compactIfNeeded();
+    void sortIds(std::vector<uint32_t>& result) const;
+
+public:
+    /**
+     * @brief Default constructor
+     * @details Creates an empty store
+     */
+    ColumnarStudentStore();
+
+    /**
+     * @brief Add a student or replace the row of a student with the same ID
+     * @param student Student to copy into the columns
+     */
+    void upsert(const Student& student);
+
+    /**
+     * @brief Refresh the course list of a student
+     * @param student Student whose courses changed
+     */
+    void updateCourses(const Student& student);
+
+    /**
+     * @brief Remove a student
+     * @param studentId ID of the student to remove
+     * @return true if a row was removed, false if the ID is unknown
+     */
+    bool erase(uint32_t studentId);
+
+    /**
+     * @brief Remove every row
+     */
+    void clear();
+
+    /**
+     * @brief Reserve room for a number of rows
+     * @param rows Expected row count
+     */
+    void reserve(std::size_t rows);
+
+    /**
+     * @brief Get the number of live students
+     * @return Student count
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Find the students whose age lies in a range
+     * @param minAge Smallest age to include
+     * @param maxAge Largest age to include
+     * @return Matching IDs in ascending order
+     */
+    std::vector<uint32_t> filterByAgeRange(int minAge, int maxAge) const;
+
+    /**
+     * @brief Count the students whose age lies in a range
+     * @param minAge Smallest age to include
+     * @param maxAge Largest age to include
+     * @return Number of matching students
+     */
+    std::size_t countByAgeRange(int minAge, int maxAge) const;
+
+    /**
+     * @brief Find the students whose ID lies in a range
+     * @param firstId Smallest ID to include
+     * @param lastId Largest ID to include
+     * @return Matching IDs in ascending order
+     */
+    std::vector<uint32_t> filterByIdRange(uint32_t firstId, uint32_t lastId) const;
+
+    /**
+     * @brief Get the name of a student
+     * @param studentId ID of the student
+     * @return Name bytes inside the arena, empty if the ID is unknown
+     */
+    std::string_view getName(uint32_t studentId) const;
+
+    /**
+     * @brief Rebuild a Student from its row
+     * @param studentId ID of the student
+     * @return The Student, or std::nullopt if the ID is unknown
+     */
+    std::optional<Student> materialize(uint32_t studentId) const;
+};
+
+#endif // COLUMNAR_STUDENT_STORE_H__
@@ -0,0 +1,76 @@
+#ifndef COURSE_DICTIONARY_H__
+#define COURSE_DICTIONARY_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/**
+ * @class CourseDictionary
+ * @brief Process-wide intern table mapping course names to small integer IDs
+ *
+ * @details Students hold course IDs instead of course names, so a name shared
+ *          by thousands of enrollments is stored once and enrollment checks
+ *          are integer compares. IDs are handed out densely from 0 in first
+ *          seen order and are never reused; the table only grows.
+ *
+ *          Names live in a std::deque, whose elements never move, so the
+ *          references returned by name() and the string_view keys of the
+ *          lookup map stay valid for the life of the process.
+ *
+ *          All methods are thread-safe. Lookups take a shared lock; only
+ *          interning a name that is not in the table yet takes the exclusive
+ *          lock.
+ */
+class CourseDictionary {
+private:
+    mutable std::shared_mutex mutex;                         ///< Guards names and ids
+    std::deque<std::string> names;                           ///< Course ID -> name
+    std::unordered_map<std::string_view, uint32_t> ids;      ///< Name -> course ID, keys point into names
+
+    CourseDictionary() = default;
+
+public:
+    CourseDictionary(const CourseDictionary&) = delete;
+    CourseDictionary& operator=(const CourseDictionary&) = delete;
+
+    /**
+     * @brief Get the table shared by every Student
+     * @return The process-wide dictionary
+     */
+    static CourseDictionary& instance();
+
+    /**
+     * @brief Get the ID of a course, adding the name if it is new
+     * @param course Course name
+     * @return Course ID
+     */
+    uint32_t intern(std::string_view course);
+
+    /**
+     * @brief Look up the ID of a course without adding it
+     * @param course Course name
+     * @return Course ID, or std::nullopt if no student was ever enrolled in it
+     */
+    std::optional<uint32_t> find(std::string_view course) const;
+
+    /**
+     * @brief Get the name of a course
+     * @param courseId Course ID returned by intern()
+     * @return Course name; an empty string for unknown IDs
+     */
+    const std::string& name(uint32_t courseId) const;
+
+    /**
+     * @brief Get the number of distinct course names
+     * @return Course count
+     */
+    std::size_t size() const;
+};
+
+#endif // COURSE_DICTIONARY_H__
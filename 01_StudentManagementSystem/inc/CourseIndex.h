@@ -0,0 +1,88 @@
+#ifndef COURSE_INDEX_H__
+#define COURSE_INDEX_H__
+
+#include "RoaringBitmap.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class CourseIndex
+ * @brief Inverted index from course to the students enrolled in it
+ *
+ * @details Keeps one RoaringBitmap of student IDs per CourseDictionary ID.
+ *          Course IDs are dense, so the bitmaps live in a vector indexed by
+ *          course ID and finding a course's set is a bounds check.
+ *
+ *          The bitmaps compress the dense student ID space and combine with
+ *          word-level operations, so set-algebra queries over several
+ *          courses never touch Student objects.
+ */
+class CourseIndex {
+private:
+    std::vector<RoaringBitmap> postings;  ///< Course ID -> enrolled student IDs
+
+public:
+    /**
+     * @brief Record that a student is enrolled in a course
+     * @param courseId CourseDictionary ID of the course
+     * @param studentId ID of the student
+     */
+    void add(uint32_t courseId, uint32_t studentId);
+
+    /**
+     * @brief Record that a student left a course
+     * @param courseId CourseDictionary ID of the course
+     * @param studentId ID of the student
+     */
+    void remove(uint32_t courseId, uint32_t studentId);
+
+    /**
+     * @brief Record every enrollment of a student
+     * @param studentId ID of the student
+     * @param courseIds CourseDictionary IDs the student is enrolled in
+     */
+    void addStudent(uint32_t studentId, const std::vector<uint32_t>& courseIds);
+
+    /**
+     * @brief Forget every enrollment of a student
+     * @param studentId ID of the student
+     * @param courseIds CourseDictionary IDs the student was indexed with
+     */
+    void removeStudent(uint32_t studentId, const std::vector<uint32_t>& courseIds);
+
+    /**
+     * @brief Drop every course's student set
+     */
+    void clear();
+
+    /**
+     * @brief Get the students enrolled in a course
+     * @param courseId CourseDictionary ID of the course
+     * @return Set of student IDs; empty for courses without students
+     */
+    const RoaringBitmap& students(uint32_t courseId) const;
+
+    /**
+     * @brief Get the number of students enrolled in a course
+     * @param courseId CourseDictionary ID of the course
+     * @return Enrollment count
+     */
+    std::size_t count(uint32_t courseId) const;
+
+    /**
+     * @brief Get the students enrolled in every one of some courses
+     * @param courseIds CourseDictionary IDs; must not be empty
+     * @return Intersection of the courses' student sets
+     */
+    RoaringBitmap matchAll(const std::vector<uint32_t>& courseIds) const;
+
+    /**
+     * @brief Get the students enrolled in at least one of some courses
+     * @param courseIds CourseDictionary IDs
+     * @return Union of the courses' student sets
+     */
+    RoaringBitmap matchAny(const std::vector<uint32_t>& courseIds) const;
+};
+
+#endif // COURSE_INDEX_H__
@@ -0,0 +1,99 @@
+#ifndef CSV_PARSER_H__
+#define CSV_PARSER_H__
+
+#include "Student.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class CsvParser
+ * @brief Block-based parser for the student CSV data file
+ *
+ * @details Reads the data file in large blocks and splits every record into
+ *          std::string_view fields over the block buffer. Numeric fields are
+ *          converted with std::from_chars, so the only allocations made per
+ *          record are the strings that end up stored in the Student.
+ *
+ *          The accepted format is the one written by FileManager::saveStudents:
+ *          ID,Name,Email,Age,Course1,Course2,...
+ *
+ *          Malformed numeric fields raise the same exceptions std::stoi would
+ *          (std::invalid_argument / std::out_of_range), so callers see the same
+ *          behaviour as the previous getline/stringstream reader.
+ */
+class CsvParser {
+private:
+    std::size_t blockSize;    ///< Number of bytes requested from the file per read
+
+public:
+    static constexpr std::size_t DEFAULT_BLOCK_SIZE = 1 << 20;  ///< 1 MiB
+
+    /**
+     * @brief Constructor for CsvParser
+     * @param blockSize Number of bytes to read from the file at a time
+     */
+    explicit CsvParser(std::size_t blockSize = DEFAULT_BLOCK_SIZE);
+
+    /**
+     * @brief Parse a whole data file
+     * @param filePath Path to the CSV data file
+     * @param students Vector the parsed Student objects are appended to
+     * @return true if the file could be opened and read, false otherwise
+     */
+    bool parseFile(const std::string& filePath, std::vector<Student>& students) const;
+
+    /**
+     * @brief Parse the records that start inside a byte range of a data file
+     * @param filePath Path to the CSV data file
+     * @param begin Offset of the first byte of the range, must be the start of a record
+     * @param end Offset one past the last byte of the range
+     * @param students Vector the parsed Student objects are appended to
+     * @return true if the file could be opened and read, false otherwise
+     */
+    bool parseRange(const std::string& filePath, std::uint64_t begin, std::uint64_t end,
+                    std::vector<Student>& students) const;
+
+    /**
+     * @brief Parse a whole data file on several threads
+     * @param filePath Path to the CSV data file
+     * @param threadCount Number of worker threads (and byte ranges) to use
+     * @param students Vector the parsed Student objects are appended to, in file order
+     * @return true if the file could be opened and read, false otherwise
+     * @details The file is split into threadCount ranges aligned to record
+     *          boundaries, each range is parsed by its own thread and the
+     *          per-thread results are concatenated. An exception thrown while
+     *          parsing a range is rethrown on the calling thread.
+     */
+    bool parseFileParallel(const std::string& filePath, unsigned threadCount,
+                           std::vector<Student>& students) const;
+
+    /**
+     * @brief Split a data file into byte ranges that start at record boundaries
+     * @param filePath Path to the CSV data file
+     * @param parts Requested number of ranges
+     * @return Sorted range boundaries, from 0 to the file size; range i is
+     *         [bounds[i], bounds[i + 1]). Fewer ranges are returned when the
+     *         file has fewer records than requested parts.
+     */
+    static std::vector<std::uint64_t> splitRanges(const std::string& filePath, unsigned parts);
+
+    /**
+     * @brief Parse every record contained in a buffer
+     * @param buffer Text holding zero or more newline separated records
+     * @param students Vector the parsed Student objects are appended to
+     * @details A final record without a trailing newline is parsed as well
+     */
+    static void parseBuffer(std::string_view buffer, std::vector<Student>& students);
+
+    /**
+     * @brief Parse a single record
+     * @param line One record without its terminating newline
+     * @return The Student described by the record
+     */
+    static Student parseLine(std::string_view line);
+};
+
+#endif // CSV_PARSER_H__
@@ -1,8 +1,15 @@
 #ifndef DATA_HANDLER_H__
 #define DATA_HANDLER_H__
 
+#include "BackgroundSaver.h"
 #include "StudentManager.h"
 #include "FileManager.h"
+#include "Journal.h"
+#include <cstdint>
+#include <future>
+
+/// Number of journal records after which saveData writes a checkpoint
+constexpr uint64_t CHECKPOINT_RECORD_THRESHOLD = 10000;
 
 /**
  * @brief Save student data to a file
@@ -12,12 +19,56 @@
  */
 void saveData(StudentManager& manager, FileManager& fileManager);
 
+/**
+ * @brief Save student data to a file on a background thread
+ * @param saver BackgroundSaver writing the manager's students
+ * @return Future that becomes the result of the save
+ * @details Returns once a snapshot is taken; the students can be changed
+ *          while the file is written. Requests made while a save is waiting
+ *          are merged into it. Writes the full CSV file, so it is an explicit
+ *          export rather than part of saving, which goes through the journal.
+ */
+std::shared_future<bool> saveDataInBackground(BackgroundSaver& saver);
+
 /**
  * @brief Load student data from a file
  * @param manager Reference to the StudentManager instance
  * @param fileManager Reference to the FileManager instance
- * @details Loads student data from the file specified in FileManager and populates the StudentManager
+ * @details Loads student data from the file specified in FileManager and populates the StudentManager,
+ *          keeping the student IDs stored in the file
  */
 void loadData(StudentManager& manager, FileManager& fileManager);
 
+/**
+ * @brief Save student data incrementally through a journal
+ * @param manager Reference to the StudentManager instance
+ * @param fileManager Reference to the FileManager instance
+ * @param journal Reference to the Journal attached to the manager
+ * @details Makes the journaled changes durable, so the cost depends on the number
+ *          of changes since the last save. Once the journal holds
+ *          CHECKPOINT_RECORD_THRESHOLD records it is compacted into a snapshot.
+ */
+void saveData(StudentManager& manager, FileManager& fileManager, Journal& journal);
+
+/**
+ * @brief Load student data and replay the journal on top of it
+ * @param manager Reference to the StudentManager instance
+ * @param fileManager Reference to the FileManager instance
+ * @param journal Reference to the Journal to replay and attach
+ * @details Loads the binary snapshot if there is one, otherwise the CSV file,
+ *          applies the journal records written since, then opens the journal
+ *          and attaches it to the manager
+ */
+void loadData(StudentManager& manager, FileManager& fileManager, Journal& journal);
+
+/**
+ * @brief Compact the journal into a snapshot
+ * @param manager Reference to the StudentManager instance
+ * @param fileManager Reference to the FileManager instance
+ * @param journal Reference to the Journal attached to the manager
+ * @details Writes the full state as a binary snapshot, then drops the journal
+ *          records it contains
+ */
+void checkpointData(StudentManager& manager, FileManager& fileManager, Journal& journal);
+
 #endif // DATA_HANDLER_H__
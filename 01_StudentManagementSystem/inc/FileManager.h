@@ -2,9 +2,16 @@
 #define FILE_MANAGER_H__
 
 #include "Student.h"
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <optional>
 #include <vector>
 #include <string>
 
+class StudentManager;
+class StudentSnapshot;
+
 /**
  * @class FileManager
  * @brief Manages file operations for student data persistence
@@ -13,18 +20,57 @@
  *          in CSV format. It provides functionality for:
  *          - Saving student records to file
  *          - Loading student records from file
+ *          - Saving and loading binary snapshots next to the CSV file
+ *          - Serving read-only lookups straight from a memory-mapped snapshot
  *          - Basic file management operations
  */
 class FileManager {
 private:
+    struct MappedSnapshot;
+
     std::string dataFilePath;    ///< Path to the data storage file
+    std::string snapshotFilePath;  ///< Path to the binary snapshot file
+    unsigned loadThreadCount;    ///< Maximum number of threads used by loadStudents
+    std::unique_ptr<MappedSnapshot> mappedSnapshot;  ///< Mapped snapshot, null when not mapped
 
 public:
+    static constexpr std::uint64_t MIN_BYTES_PER_LOAD_THREAD = 1 << 20;  ///< 1 MiB
+
     /**
      * @brief Constructor for FileManager
      * @param filePath Path to the data file
+     * @param loadThreads Maximum number of threads used to parse the data file
+     */
+    FileManager(const std::string& filePath, unsigned loadThreads = 1);
+
+    /**
+     * @brief Destructor
+     * @details Unmaps the snapshot if it is mapped
+     */
+    ~FileManager();
+
+    /**
+     * @brief Set the maximum number of threads used by loadStudents
+     * @param threads Thread count, 0 or 1 selects the single-threaded reader
+     * @details Files are only split when every thread gets at least
+     *          MIN_BYTES_PER_LOAD_THREAD bytes, so small files stay single-threaded
      */
-    FileManager(const std::string& filePath);
+    void setLoadThreadCount(unsigned threads);
+
+    /**
+     * @brief Get the maximum number of threads used by loadStudents
+     * @return Configured thread count
+     */
+    unsigned getLoadThreadCount() const;
+
+    /**
+     * @brief Write one student as a record of the CSV data file
+     * @param out Stream to write to
+     * @param student Student to write
+     * @details The record format of every saveStudents overload, for other
+     *          writers whose files loadStudents has to read
+     */
+    static void writeCsvRecord(std::ostream& out, const Student& student);
     
     /**
      * @brief Save student data to file
@@ -33,12 +79,129 @@ public:
      */
     bool saveStudents(const std::vector<Student>& students);
 
+    /**
+     * @brief Save every student of a manager to file
+     * @param manager Manager whose students are written, in ID order
+     * @return true if save operation was successful, false otherwise
+     */
+    bool saveStudents(const StudentManager& manager);
+
+    /**
+     * @brief Save the students of a point-in-time view to file
+     * @param view Snapshot whose students are written, in ID order
+     * @return true if save operation was successful, false otherwise
+     */
+    bool saveStudents(const StudentSnapshot& view);
+
     /**
      * @brief Load student data from file
      * @return Vector of Student objects loaded from file
      */
     std::vector<Student> loadStudents();
     
+    /**
+     * @brief Save student data to the binary snapshot file
+     * @param students Vector of Student objects to save
+     * @return true if save operation was successful, false otherwise
+     */
+    bool saveSnapshot(const std::vector<Student>& students);
+
+    /**
+     * @brief Save every student of a manager to the binary snapshot file
+     * @param manager Manager whose students are written
+     * @return true if save operation was successful, false otherwise
+     * @details Safe while other threads mutate the manager: the students are
+     *          written from a point-in-time snapshot
+     */
+    bool saveSnapshot(const StudentManager& manager);
+
+    /**
+     * @brief Save the students of a point-in-time view to the binary snapshot file
+     * @param view Snapshot whose students are written
+     * @return true if save operation was successful, false otherwise
+     */
+    bool saveSnapshot(const StudentSnapshot& view);
+
+    /**
+     * @brief Load student data from the binary snapshot file
+     * @return Vector of Student objects loaded from the snapshot, empty if the
+     *         snapshot is missing or invalid
+     */
+    std::vector<Student> loadSnapshot();
+
+    /**
+     * @brief Check if the binary snapshot file exists
+     * @return true if the snapshot exists and is accessible, false otherwise
+     */
+    bool snapshotExists() const;
+
+    /**
+     * @brief Get the path of the binary snapshot file
+     * @return The data file path with ".snap" appended
+     */
+    const std::string& getSnapshotPath() const;
+
+    /**
+     * @brief Convert the CSV data file into a binary snapshot
+     * @return true if the snapshot was written, false otherwise
+     */
+    bool convertCsvToSnapshot();
+
+    /**
+     * @brief Convert the binary snapshot back into the CSV data file
+     * @return true if the CSV file was written, false otherwise
+     */
+    bool convertSnapshotToCsv();
+
+    // Read-only mode over a memory-mapped snapshot
+    /**
+     * @brief Memory-map the binary snapshot for read-only lookups
+     * @return true if the snapshot was mapped and its header is valid, false otherwise
+     * @details Only the header is read, so mapping takes the same time for any
+     *          roster size. Pages are loaded on demand and shared with every
+     *          other process mapping the same file.
+     */
+    bool mapSnapshot();
+
+    /**
+     * @brief Release the memory-mapped snapshot
+     */
+    void unmapSnapshot();
+
+    /**
+     * @brief Check whether the snapshot is memory-mapped
+     * @return true if mapSnapshot succeeded and unmapSnapshot was not called since
+     */
+    bool isSnapshotMapped() const;
+
+    /**
+     * @brief Get the number of students in the mapped snapshot
+     * @return Number of students, 0 when no snapshot is mapped
+     */
+    size_t getMappedStudentCount() const;
+
+    /**
+     * @brief Retrieve a student from the mapped snapshot
+     * @param studentId The ID of the student to find
+     * @return The Student built from its record, or std::nullopt if not found
+     *         or no snapshot is mapped
+     */
+    std::optional<Student> getStudent(uint32_t studentId) const;
+
+    /**
+     * @brief Search the mapped snapshot for students by name
+     * @param name Full or partial name to search for (case-insensitive)
+     * @return IDs of matching students in ID order; no Student is built
+     */
+    std::vector<uint32_t> searchStudentIdsByName(const std::string& name) const;
+
+    /**
+     * @brief Search the mapped snapshot for students by name
+     * @param name Full or partial name to search for (case-insensitive)
+     * @return Matching students in ID order; only the matches are built
+     */
+    std::vector<Student> searchStudentsByName(const std::string& name) const;
+    
     /**
      * @brief Check if the data file exists
      * @return true if file exists and is accessible, false otherwise
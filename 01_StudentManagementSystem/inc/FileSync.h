@@ -0,0 +1,35 @@
+#ifndef FILE_SYNC_H__
+#define FILE_SYNC_H__
+
+#include <string>
+
+/**
+ * @brief Flush a file's data to stable storage
+ * @param filePath Path of a closed file
+ * @return true if the file was synced, false otherwise
+ * @details The file is reopened read-only and fsync'ed; fsync applies to the
+ *          file, not to the descriptor that wrote it.
+ */
+bool syncFile(const std::string& filePath);
+
+/**
+ * @brief Flush the directory entry of a file to stable storage
+ * @param filePath Path of a file whose directory is synced
+ * @return true if the directory was synced, false otherwise
+ * @details Needed after a rename, which only changes the directory. A no-op
+ *          on platforms that cannot sync directories.
+ */
+bool syncParentDirectory(const std::string& filePath);
+
+/**
+ * @brief Durably replace a file with a completely written temporary file
+ * @param tempPath Closed temporary file holding the new contents
+ * @param filePath File to replace
+ * @return true if the new contents are in place and on stable storage
+ * @details The temporary file is synced before the rename and the directory
+ *          after it, so after a crash filePath holds either the old or the
+ *          complete new contents. On failure the temporary file is removed.
+ */
+bool replaceFileDurably(const std::string& tempPath, const std::string& filePath);
+
+#endif // FILE_SYNC_H__
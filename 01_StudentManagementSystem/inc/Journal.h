@@ -0,0 +1,281 @@
+#ifndef JOURNAL_H__
+#define JOURNAL_H__
+
+#include "Student.h"
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+
+class StudentManager;
+
+/**
+ * @brief When journal records are written and flushed to stable storage
+ */
+struct DurabilityPolicy {
+    /**
+     * @brief Commit strategies
+     */
+    enum class Mode {
+        Manual,           ///< Only explicit sync() calls commit
+        EveryOperation,   ///< Every mutation is durable before it returns
+        Interval,         ///< A background thread commits every intervalMs milliseconds
+        OperationCount,   ///< A commit is made once operationCount records are pending
+        OsManaged         ///< Records are handed to the OS right away but never fsync'ed
+    };
+
+    Mode mode = Mode::Manual;          ///< Selected strategy
+    unsigned intervalMs = 100;         ///< Commit period for Mode::Interval
+    unsigned operationCount = 64;      ///< Batch size for Mode::OperationCount
+};
+
+/**
+ * @brief Group-commit counters of a Journal
+ */
+struct JournalStats {
+    static constexpr size_t BATCH_BUCKETS = 16;
+
+    uint64_t commitCount = 0;          ///< Commit rounds, each one write and/or one fsync
+    uint64_t syncCount = 0;            ///< fsync calls made
+    uint64_t recordsCommitted = 0;     ///< Records written in all batches
+    uint64_t maxBatchRecords = 0;      ///< Largest batch written
+    uint64_t totalCommitNanos = 0;     ///< Time spent in write+fsync
+    uint64_t maxCommitNanos = 0;       ///< Slowest single write+fsync
+    uint64_t failedCommits = 0;        ///< Batches that could not be written or synced
+    /// Batch size histogram, bucket i counts batches of [2^i, 2^(i+1)) records
+    std::array<uint64_t, BATCH_BUCKETS> batchSizeHistogram{};
+
+    /**
+     * @brief Average number of records per batch
+     * @return Records per batch, 0 if nothing was committed
+     */
+    double averageBatchRecords() const;
+
+    /**
+     * @brief Average latency of a commit
+     * @return Microseconds per batch, 0 if nothing was committed
+     */
+    double averageCommitMicros() const;
+};
+
+/**
+ * @class Journal
+ * @brief Append-only write-ahead log of StudentManager mutations
+ *
+ * @details Every successful addStudent, deleteStudent, enrollStudentInCourse
+ *          and removeStudentFromCourse on a StudentManager the journal is
+ *          attached to is appended as a compact binary record. Records are
+ *          buffered in memory and committed in batches: one write and, for
+ *          durable commits, one fsync cover every record appended since the
+ *          previous commit. When several threads wait for their records at
+ *          once, the first becomes the leader and commits the whole batch
+ *          while the others wait for it (group commit). The DurabilityPolicy
+ *          decides when commits happen; a crash loses at most the records
+ *          that were not committed yet.
+ *
+ *          On disk the journal is an 8-byte magic followed by records of the form
+ *          [uint32 payload length][uint32 checksum][uint8 type][payload].
+ *          Replay stops at the first incomplete or corrupt record, which is how
+ *          a write torn by a crash shows up, and cuts the file back to the last
+ *          good record.
+ *
+ *          Replaying a journal on top of a state that already contains some of
+ *          its records converges to the same result, so a crash between writing
+ *          a checkpoint and resetting the journal is harmless.
+ */
+class Journal {
+public:
+    /**
+     * @brief Kinds of journal records
+     */
+    enum class RecordType : uint8_t {
+        AddStudent = 1,      ///< Full student record (ID, name, email, age, courses)
+        DeleteStudent = 2,   ///< Student ID
+        EnrollCourse = 3,    ///< Student ID and course name
+        RemoveCourse = 4     ///< Student ID and course name
+    };
+
+private:
+    std::string journalFilePath;   ///< Path to the journal file
+    std::FILE* file;               ///< Open journal file, nullptr when closed
+    std::string pending;           ///< Encoded records not written yet
+    uint64_t recordCount;          ///< Records in the journal since the last reset
+
+    DurabilityPolicy policy;       ///< Current commit strategy
+    JournalStats stats;            ///< Commit counters
+    uint64_t appendedSequence;     ///< Sequence number of the last appended record
+    uint64_t writtenSequence;      ///< Last record handed to the OS
+    uint64_t durableSequence;      ///< Last record known to be on stable storage
+    uint64_t failedFirst;          ///< First record of the last batch that failed (empty range if none)
+    uint64_t failedLast;           ///< Last record of the last batch that failed
+    bool commitInProgress;         ///< A leader is writing a batch
+
+    mutable std::mutex mutex;              ///< Guards all state above
+    std::condition_variable committed;     ///< Signalled when a batch finishes
+    std::condition_variable flusherWakeup; ///< Wakes the interval flusher early
+    std::thread flusher;                   ///< Background thread for Mode::Interval
+    bool stopFlusher;                      ///< Asks the flusher to exit
+
+    uint64_t append(RecordType type, const std::string& payload);
+    bool commit(std::unique_lock<std::mutex>& lock, uint64_t sequence, bool durable);
+    void startFlusher();
+    void stopFlusherThread();
+    void flusherLoop();
+
+public:
+    /**
+     * @brief Constructor for Journal
+     * @param filePath Path to the journal file
+     */
+    explicit Journal(const std::string& filePath);
+
+    /**
+     * @brief Destructor
+     * @details Syncs pending records and closes the file
+     */
+    ~Journal();
+
+    Journal(const Journal&) = delete;
+    Journal& operator=(const Journal&) = delete;
+
+    /**
+     * @brief Open the journal for appending, creating it if needed
+     * @return true if the journal is open, false otherwise
+     */
+    bool open();
+
+    /**
+     * @brief Sync pending records and close the journal
+     * @details Also stops the background flusher of Mode::Interval
+     */
+    void close();
+
+    /**
+     * @brief Choose when records are committed
+     * @param newPolicy The commit strategy
+     * @details Pending records are synced before the policy changes
+     */
+    void setDurabilityPolicy(const DurabilityPolicy& newPolicy);
+
+    /**
+     * @brief Get the commit strategy
+     * @return The current policy
+     */
+    DurabilityPolicy getDurabilityPolicy() const;
+
+    /**
+     * @brief Get the group-commit counters
+     * @return Copy of the counters
+     */
+    JournalStats getStats() const;
+
+    /**
+     * @brief Check whether the journal is open
+     * @return true if open() succeeded and close() was not called since
+     */
+    bool isOpen() const;
+
+    // Recording mutations
+    // Each record* method only appends to the pending batch and returns the
+    // record's sequence number; commitPerPolicy applies the durability policy.
+    /**
+     * @brief Record that a student was added
+     * @param student The student as stored, including its assigned ID
+     * @return Sequence number of the record
+     */
+    uint64_t recordAddStudent(const Student& student);
+
+    /**
+     * @brief Record that a student was deleted
+     * @param studentId ID of the deleted student
+     * @return Sequence number of the record
+     */
+    uint64_t recordDeleteStudent(uint32_t studentId);
+
+    /**
+     * @brief Record that a student was enrolled in a course
+     * @param studentId ID of the student
+     * @param course Name of the course
+     * @return Sequence number of the record
+     */
+    uint64_t recordEnrollment(uint32_t studentId, const std::string& course);
+
+    /**
+     * @brief Record that a student was removed from a course
+     * @param studentId ID of the student
+     * @param course Name of the course
+     * @return Sequence number of the record
+     */
+    uint64_t recordCourseRemoval(uint32_t studentId, const std::string& course);
+
+    /**
+     * @brief Apply the durability policy to a recorded mutation
+     * @param sequence Sequence number returned by a record* method
+     * @return false if a commit made for this record failed
+     * @details With Mode::EveryOperation this blocks until the record is durable,
+     *          sharing the write and fsync with every other waiting thread.
+     *          Callers should not hold locks other threads need to append.
+     */
+    bool commitPerPolicy(uint64_t sequence);
+
+    /**
+     * @brief Write pending records and flush them to stable storage
+     * @return true if every appended record is durable, false otherwise
+     */
+    bool sync();
+
+    /**
+     * @brief Apply the records stored in the journal file to a manager
+     * @param manager StudentManager to apply the records to
+     * @return Number of records applied
+     * @details The manager's own journal is detached while replaying so the
+     *          records are not appended a second time. A torn tail is cut off.
+     */
+    uint64_t replay(StudentManager& manager);
+
+    /**
+     * @brief Empty the journal after its records were checkpointed
+     * @return true if the journal was truncated, false otherwise
+     */
+    bool reset();
+
+    /**
+     * @brief Drop the records a checkpoint contains, keeping later ones
+     * @param throughSequence Last record the checkpoint contains, as returned
+     *        by StudentManager::snapshot(uint64_t&)
+     * @return true if the journal was rewritten, false otherwise
+     * @details Records appended while the checkpoint was being written stay
+     *          in the journal. The new journal is synced before it replaces
+     *          the old one.
+     */
+    bool reset(uint64_t throughSequence);
+
+    /**
+     * @brief Get the sequence number of the last appended record
+     * @return Sequence number, 0 if nothing was appended since construction
+     */
+    uint64_t getAppendedSequence() const;
+
+    /**
+     * @brief Get the number of records appended but not yet written to the file
+     * @return Pending record count
+     */
+    uint64_t getPendingRecordCount() const;
+
+    /**
+     * @brief Get the number of records in the journal since the last reset
+     * @return Record count, including pending records
+     */
+    uint64_t getRecordCount() const;
+
+    /**
+     * @brief Get the path of the journal file
+     * @return Journal file path
+     */
+    const std::string& getPath() const;
+};
+
+#endif // JOURNAL_H__
@@ -0,0 +1,70 @@
+#ifndef MAPPED_FILE_H__
+#define MAPPED_FILE_H__
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @class MappedFile
+ * @brief Read-only memory mapping of a whole file
+ *
+ * @details The file is mapped shared and read-only, so several processes
+ *          mapping the same file share its pages in the page cache. On
+ *          platforms without mmap the file is read into memory instead.
+ */
+class MappedFile {
+private:
+    const char* mappedData;        ///< Start of the mapping, nullptr when closed
+    std::size_t mappedSize;        ///< Size of the mapping in bytes
+    std::vector<char> fallback;    ///< File contents when mmap is not available, empty otherwise
+
+public:
+    /**
+     * @brief Default constructor
+     * @details Creates a closed mapping
+     */
+    MappedFile();
+
+    /**
+     * @brief Destructor
+     * @details Unmaps the file if it is still mapped
+     */
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Map a file
+     * @param filePath Path of the file to map
+     * @return true if the file was mapped, false otherwise
+     * @details Any previous mapping is released first. Empty files cannot be mapped.
+     */
+    bool open(const std::string& filePath);
+
+    /**
+     * @brief Release the mapping
+     */
+    void close();
+
+    /**
+     * @brief Check whether a file is mapped
+     * @return true if a file is mapped, false otherwise
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Get the mapped bytes
+     * @return Start of the mapping, nullptr when closed
+     */
+    const char* data() const;
+
+    /**
+     * @brief Get the size of the mapping
+     * @return Number of mapped bytes
+     */
+    std::size_t size() const;
+};
+
+#endif // MAPPED_FILE_H__
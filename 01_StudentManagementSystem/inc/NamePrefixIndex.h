@@ -0,0 +1,60 @@
+#ifndef NAME_PREFIX_INDEX_H__
+#define NAME_PREFIX_INDEX_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * @class NamePrefixIndex
+ * @brief Sorted index of case-folded names for prefix (type-ahead) lookups
+ *
+ * @details Keeps one (folded name, student ID) entry per student in an ordered
+ *          set. All names starting with a prefix form one contiguous range, so
+ *          a lookup is a single O(log n) seek followed by a walk over at most
+ *          limit entries; matches past the limit are never touched.
+ */
+class NamePrefixIndex {
+private:
+    std::set<std::pair<std::string, uint32_t>> entries;  ///< (folded name, ID), sorted
+
+public:
+    /**
+     * @brief Index a name
+     * @param studentId ID of the student
+     * @param name Name as stored in the Student
+     */
+    void add(uint32_t studentId, std::string_view name);
+
+    /**
+     * @brief Remove a previously indexed name
+     * @param studentId ID of the student
+     * @param name Name the student was indexed with
+     */
+    void remove(uint32_t studentId, std::string_view name);
+
+    /**
+     * @brief Drop every entry
+     */
+    void clear();
+
+    /**
+     * @brief Find the students whose names start with a prefix
+     * @param foldedPrefix Prefix already passed through TrigramIndex::fold()
+     * @param limit Maximum number of IDs to return
+     * @return IDs ordered by folded name, then by ID
+     */
+    std::vector<uint32_t> find(std::string_view foldedPrefix, std::size_t limit) const;
+
+    /**
+     * @brief Get the number of indexed names
+     * @return Entry count
+     */
+    std::size_t size() const;
+};
+
+#endif // NAME_PREFIX_INDEX_H__
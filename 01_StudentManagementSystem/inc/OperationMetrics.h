@@ -0,0 +1,307 @@
+#ifndef OPERATION_METRICS_H__
+#define OPERATION_METRICS_H__
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+/**
+ * @brief Instrumented operations of StudentManager and FileManager
+ */
+enum class Operation : uint8_t {
+    AddStudent,        ///< StudentManager::addStudent
+    BulkLoadStudents,  ///< StudentManager::bulkLoadStudents, the insert phase of a load
+    DeleteStudent,     ///< StudentManager::deleteStudent
+    GetStudent,        ///< StudentManager::getStudent and findStudent
+    SearchStudents,    ///< StudentManager::searchStudentsByName, findStudentsByName and prefix search
+    EnrollInCourse,    ///< StudentManager::enrollStudentInCourse
+    RemoveFromCourse,  ///< StudentManager::removeStudentFromCourse
+    GetAllStudents,    ///< StudentManager::getAllStudents
+    LoadStudents,      ///< FileManager::loadStudents, reading and parsing the CSV file
+    SaveStudents,      ///< FileManager::saveStudents
+    LoadSnapshot,      ///< FileManager::loadSnapshot
+    SaveSnapshot       ///< FileManager::saveSnapshot
+};
+
+/// Number of Operation values
+constexpr size_t OPERATION_COUNT = 12;
+
+/**
+ * @brief Get the name of an operation as used in the text and JSON reports
+ * @param operation The operation
+ * @return Name such as "addStudent"
+ */
+const char* operationName(Operation operation);
+
+/**
+ * @class LatencyHistogram
+ * @brief Log-linear latency histogram in the style of HdrHistogram
+ *
+ * @details Every power of two of nanoseconds is split into SUB_BUCKETS equal
+ *          buckets, so a recorded value is known to within 1/SUB_BUCKETS
+ *          (about 6%) at any magnitude. Values up to 2^44 ns (almost five
+ *          hours) fit; longer ones land in the last bucket. The count, sum,
+ *          minimum and maximum are exact.
+ */
+class LatencyHistogram {
+public:
+    static constexpr unsigned SUB_BUCKET_BITS = 4;
+    static constexpr size_t SUB_BUCKETS = size_t(1) << SUB_BUCKET_BITS;
+    static constexpr unsigned MAX_EXPONENT = 43;  ///< Largest power of two with its own buckets
+    static constexpr size_t BUCKET_COUNT = (MAX_EXPONENT - SUB_BUCKET_BITS + 2) * SUB_BUCKETS;
+
+private:
+    std::array<uint64_t, BUCKET_COUNT> buckets{};
+    uint64_t count = 0;
+    uint64_t totalNanos = 0;
+    uint64_t minNanos = 0;
+    uint64_t maxNanos = 0;
+
+public:
+    /**
+     * @brief Find the bucket of a value
+     * @param nanos Latency in nanoseconds
+     * @return Bucket index
+     */
+    static size_t bucketFor(uint64_t nanos);
+
+    /**
+     * @brief Get the largest value that falls into a bucket
+     * @param bucket Bucket index
+     * @return Upper bound in nanoseconds
+     */
+    static uint64_t bucketUpperBound(size_t bucket);
+
+    /**
+     * @brief Record one latency
+     * @param nanos Latency in nanoseconds
+     */
+    void record(uint64_t nanos);
+
+    /**
+     * @brief Add the values of another histogram
+     * @param other Histogram to add
+     */
+    void merge(const LatencyHistogram& other);
+
+    /**
+     * @brief Forget every recorded value
+     */
+    void clear();
+
+    /**
+     * @brief Get the number of recorded values
+     * @return Value count
+     */
+    uint64_t getCount() const;
+
+    /**
+     * @brief Get the smallest recorded value
+     * @return Minimum in nanoseconds, 0 when empty
+     */
+    uint64_t getMin() const;
+
+    /**
+     * @brief Get the largest recorded value
+     * @return Maximum in nanoseconds, 0 when empty
+     */
+    uint64_t getMax() const;
+
+    /**
+     * @brief Get the average recorded value
+     * @return Mean in nanoseconds, 0 when empty
+     */
+    double getMean() const;
+
+    /**
+     * @brief Get a percentile of the recorded values
+     * @param percentile Percentile between 0 and 100
+     * @return Upper bound of the bucket holding the percentile, capped at
+     *         the maximum; 0 when empty
+     */
+    uint64_t getPercentile(double percentile) const;
+};
+
+/**
+ * @brief Call count and latency distribution of one operation
+ */
+struct OperationStats {
+    uint64_t calls = 0;        ///< Completed and running calls
+    LatencyHistogram latency;  ///< Latencies of the sampled calls
+};
+
+/**
+ * @class MetricsReport
+ * @brief Aggregated metrics of all threads at one moment
+ */
+class MetricsReport {
+private:
+    std::array<OperationStats, OPERATION_COUNT> operations;
+
+public:
+    /**
+     * @brief Get the metrics of one operation
+     * @param operation The operation
+     * @return Its call count and latency histogram
+     */
+    const OperationStats& get(Operation operation) const;
+
+    /**
+     * @brief Get the metrics of one operation for modification
+     * @param operation The operation
+     * @return Its call count and latency histogram
+     */
+    OperationStats& get(Operation operation);
+
+    /**
+     * @brief Format the report as an aligned table
+     * @return One line per operation with calls, samples and latency percentiles in microseconds
+     */
+    std::string toText() const;
+
+    /**
+     * @brief Format the report as JSON
+     * @return Object keyed by operation name; latencies in nanoseconds
+     */
+    std::string toJson() const;
+};
+
+/**
+ * @brief Counters and histograms written by one thread
+ * @details Only the owning thread changes calls; other threads read them
+ *          with relaxed loads. The histograms are guarded by mutex, which
+ *          the owner only takes for sampled calls.
+ */
+struct MetricsThreadBuffer {
+    std::array<std::atomic<uint64_t>, OPERATION_COUNT> calls{};  ///< Calls per operation
+    std::mutex mutex;                                            ///< Guards latency
+    std::array<LatencyHistogram, OPERATION_COUNT> latency;       ///< Sampled latencies per operation
+};
+
+/// Buffer of the calling thread, null until its first instrumented call; use OperationMetrics::buffer()
+inline thread_local MetricsThreadBuffer* currentMetricsBuffer = nullptr;
+
+/**
+ * @class OperationMetrics
+ * @brief Process-wide registry of the per-thread metric buffers
+ *
+ * @details Every thread records into its own MetricsThreadBuffer, created
+ *          on its first instrumented call, so recording never contends with
+ *          other threads. collect() sums the buffers of all live threads
+ *          and of the threads that have exited.
+ *
+ *          Every call is counted. Reading the clock twice costs more than
+ *          some operations themselves (about 80 ns for a timed call against
+ *          40 ns for a lookup), so only one call in (sampleMask(operation) + 1)
+ *          per thread is timed: every call of the slow file and bulk
+ *          operations, one in 1024 lookups. An untimed call costs a
+ *          thread-local load and a counter increment.
+ *
+ *          Recording is compiled in with the SMS_ENABLE_METRICS definition
+ *          (CMake option of the same name); without it SMS_METRICS_SCOPE
+ *          expands to nothing and collect() reports zeros.
+ */
+class OperationMetrics {
+private:
+    static MetricsThreadBuffer* registerThread();
+
+public:
+    /**
+     * @brief Get the buffer of the calling thread, creating it on first use
+     * @return The thread's buffer
+     */
+    static MetricsThreadBuffer& buffer() {
+        MetricsThreadBuffer* current = currentMetricsBuffer;
+        return current ? *current : *registerThread();
+    }
+
+    /**
+     * @brief Get which calls of an operation are timed
+     * @param operation The operation
+     * @return Mask; a call is timed when its per-thread call number ANDed with it is 0
+     */
+    static constexpr uint64_t sampleMask(Operation operation) {
+        switch (operation) {
+            case Operation::GetStudent:
+                return 1023;
+            case Operation::EnrollInCourse:
+            case Operation::RemoveFromCourse:
+                return 63;
+            case Operation::AddStudent:
+            case Operation::DeleteStudent:
+            case Operation::SearchStudents:
+                return 7;
+            default:
+                return 0;
+        }
+    }
+
+    /**
+     * @brief Record the latency of a sampled call
+     * @param buffer Buffer of the calling thread
+     * @param operation The operation
+     * @param nanos Latency in nanoseconds
+     */
+    static void recordLatency(MetricsThreadBuffer& buffer, Operation operation, uint64_t nanos);
+
+    /**
+     * @brief Sum the metrics of all threads
+     * @return The report
+     */
+    static MetricsReport collect();
+
+    /**
+     * @brief Zero the metrics of all threads
+     * @details Calls counted while the reset runs may survive it
+     */
+    static void reset();
+};
+
+/**
+ * @class ScopedOperation
+ * @brief Counts an operation and, if it is sampled, times it until the end of the scope
+ */
+class ScopedOperation {
+private:
+    MetricsThreadBuffer* timedBuffer;  ///< Buffer to record into, null when the call is not timed
+    Operation operation;
+    std::chrono::steady_clock::time_point start;
+
+public:
+    explicit ScopedOperation(Operation operation) : timedBuffer(nullptr), operation(operation) {
+        MetricsThreadBuffer& current = OperationMetrics::buffer();
+        std::atomic<uint64_t>& calls = current.calls[static_cast<size_t>(operation)];
+        // Only this thread writes the counter, so no atomic read-modify-write is needed
+        uint64_t call = calls.load(std::memory_order_relaxed);
+        calls.store(call + 1, std::memory_order_relaxed);
+        if ((call & OperationMetrics::sampleMask(operation)) == 0) {
+            timedBuffer = &current;
+            start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~ScopedOperation() {
+        if (timedBuffer) {
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            OperationMetrics::recordLatency(
+                *timedBuffer, operation,
+                static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+        }
+    }
+
+    ScopedOperation(const ScopedOperation&) = delete;
+    ScopedOperation& operator=(const ScopedOperation&) = delete;
+};
+
+#if defined(SMS_ENABLE_METRICS)
+/// Count the enclosing call as operation and time it if it is sampled
+#define SMS_METRICS_SCOPE(operation) ScopedOperation smsMetricsScope(operation)
+#else
+#define SMS_METRICS_SCOPE(operation) ((void)0)
+#endif
+
+#endif // OPERATION_METRICS_H__
@@ -0,0 +1,152 @@
+#ifndef ROARING_BITMAP_H__
+#define ROARING_BITMAP_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class RoaringBitmap
+ * @brief Compressed set of 32-bit integers with fast set algebra
+ *
+ * @details The value space is split into chunks of 65536 values sharing the
+ *          same upper 16 bits. Each non-empty chunk is stored in a container
+ *          that picks its representation by size:
+ *          - array container: sorted 16-bit low halves, for up to 4096 values
+ *          - bitmap container: 1024 64-bit words, one bit per value
+ *
+ *          Both representations need at most 8 KiB per chunk, so sparse and
+ *          dense sets both stay compact. Intersections, unions and
+ *          differences work container by container; two bitmap containers
+ *          are combined one 64-bit word at a time in loops the compiler
+ *          vectorizes, and cardinalities come from popcount.
+ *
+ *          Values are always kept in ascending order.
+ */
+class RoaringBitmap {
+private:
+    static constexpr uint32_t ARRAY_LIMIT = 4096;   ///< Largest array container
+    static constexpr std::size_t WORDS = 1024;      ///< Words in a bitmap container
+
+    /**
+     * @brief One chunk of 65536 values
+     */
+    struct Container {
+        uint16_t key = 0;                ///< Upper 16 bits shared by the values
+        uint32_t cardinality = 0;        ///< Number of values
+        std::vector<uint16_t> values;    ///< Sorted low halves (array container)
+        std::vector<uint64_t> words;     ///< WORDS bits (bitmap container), empty otherwise
+
+        bool isBitmap() const { return !words.empty(); }
+    };
+
+    std::vector<Container> containers;   ///< Non-empty containers, sorted by key
+    uint64_t total = 0;                  ///< Values over all containers
+
+    static void toBitmap(Container& container);
+    static void toArray(Container& container);
+    static void normalize(Container& container);
+    static Container intersect(const Container& a, const Container& b);
+    static void unite(Container& a, const Container& b);
+    static Container subtract(const Container& a, const Container& b);
+
+    Container* findContainer(uint16_t key);
+    const Container* findContainer(uint16_t key) const;
+
+public:
+    /**
+     * @brief Add a value
+     * @param value Value to add
+     * @return true if the value was added, false if it was already present
+     */
+    bool add(uint32_t value);
+
+    /**
+     * @brief Remove a value
+     * @param value Value to remove
+     * @return true if the value was removed, false if it was not present
+     */
+    bool remove(uint32_t value);
+
+    /**
+     * @brief Check whether a value is present
+     * @param value Value to look for
+     * @return true if the set contains the value
+     */
+    bool contains(uint32_t value) const;
+
+    /**
+     * @brief Get the number of values
+     * @return Set size
+     */
+    uint64_t cardinality() const;
+
+    /**
+     * @brief Check whether the set is empty
+     * @return true if there are no values
+     */
+    bool empty() const;
+
+    /**
+     * @brief Remove every value
+     */
+    void clear();
+
+    /**
+     * @brief Get the values
+     * @return Values in ascending order
+     */
+    std::vector<uint32_t> toVector() const;
+
+    /**
+     * @brief Call a function for every value in ascending order
+     * @param visit Callable taking a uint32_t
+     */
+    template <typename Visitor>
+    void forEach(Visitor&& visit) const {
+        for (const Container& container : containers) {
+            const uint32_t high = static_cast<uint32_t>(container.key) << 16;
+            if (container.isBitmap()) {
+                for (std::size_t i = 0; i < WORDS; ++i) {
+                    for (uint64_t word = container.words[i]; word != 0; word &= word - 1) {
+                        visit(high | static_cast<uint32_t>(i * 64 + __builtin_ctzll(word)));
+                    }
+                }
+            } else {
+                for (uint16_t low : container.values) {
+                    visit(high | low);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Keep only the values that are also in another set
+     * @param other Set to intersect with
+     * @return This set
+     */
+    RoaringBitmap& operator&=(const RoaringBitmap& other);
+
+    /**
+     * @brief Add every value of another set
+     * @param other Set to unite with
+     * @return This set
+     */
+    RoaringBitmap& operator|=(const RoaringBitmap& other);
+
+    /**
+     * @brief Remove every value of another set
+     * @param other Set whose values are removed
+     * @return This set
+     */
+    RoaringBitmap& operator-=(const RoaringBitmap& other);
+
+    /**
+     * @brief Compare two sets
+     * @param other Set to compare with
+     * @return true if both contain the same values
+     */
+    bool operator==(const RoaringBitmap& other) const;
+};
+
+#endif // ROARING_BITMAP_H__
@@ -0,0 +1,99 @@
+#ifndef ROSTER_GENERATOR_H__
+#define ROSTER_GENERATOR_H__
+
+#include "Student.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Shape of a generated roster
+ *
+ * @details Name lengths, course counts and ages are drawn uniformly from
+ *          their ranges. Courses are drawn from a catalogue whose popularity
+ *          follows a Zipf distribution: the course of rank r is picked with
+ *          probability proportional to 1 / (r + 1)^courseZipfExponent.
+ */
+struct RosterOptions {
+    uint64_t records = 1000;           ///< Number of students
+    uint64_t seed = 1;                 ///< The same seed and options give the same roster
+    uint32_t firstId = 1000;           ///< ID of the first student, the others follow consecutively
+    uint32_t minNameLength = 8;        ///< Shortest "First Last" name in characters, at least 5
+    uint32_t maxNameLength = 24;       ///< Longest name in characters
+    uint32_t minCourses = 0;           ///< Fewest courses per student
+    uint32_t maxCourses = 6;           ///< Most courses per student, at most courseCatalogSize
+    uint32_t courseCatalogSize = 200;  ///< Number of distinct courses
+    double courseZipfExponent = 1.0;   ///< Popularity skew, 0 makes every course equally popular
+    int minAge = 17;                   ///< Youngest student
+    int maxAge = 30;                   ///< Oldest student
+};
+
+/**
+ * @class RosterGenerator
+ * @brief Deterministic synthetic students for load tests and benchmarks
+ *
+ * @details Student i is generated from its own random stream, derived from
+ *          the seed and i alone. The roster therefore does not depend on the
+ *          order in which students are generated, and writeFile() produces
+ *          the same bytes with any number of threads.
+ *
+ *          Files are written with FileManager::writeCsvRecord, the record
+ *          format of FileManager::saveStudents, so FileManager::loadStudents
+ *          reads them like any saved data file.
+ */
+class RosterGenerator {
+private:
+    RosterOptions options;
+    std::vector<std::string> courseNames;  ///< Course names by popularity rank
+    std::vector<double> courseCdf;         ///< Cumulative Zipf probability by popularity rank
+
+public:
+    static constexpr uint64_t RECORDS_PER_BLOCK = 16384;  ///< Records a writer thread formats at a time
+
+    /**
+     * @brief Constructor
+     * @param options Shape of the roster
+     * @throws std::invalid_argument if a range is empty or out of bounds
+     */
+    explicit RosterGenerator(const RosterOptions& options);
+
+    /**
+     * @brief Get the options the roster is generated with
+     * @return The options
+     */
+    const RosterOptions& getOptions() const;
+
+    /**
+     * @brief Get the name of a course
+     * @param rank Popularity rank, 0 is the most popular course
+     * @return Course name
+     */
+    const std::string& getCourseName(uint32_t rank) const;
+
+    /**
+     * @brief Generate one student
+     * @param index Position of the student in the roster, below options.records
+     * @return Student with ID options.firstId + index
+     */
+    Student makeStudent(uint64_t index) const;
+
+    /**
+     * @brief Generate the whole roster in memory
+     * @return All options.records students, in ID order
+     */
+    std::vector<Student> makeStudents() const;
+
+    /**
+     * @brief Write the roster as a CSV data file
+     * @param path Path of the file to write
+     * @param threads Number of threads generating records
+     * @return true if the file was written, false otherwise
+     * @details Threads take blocks of RECORDS_PER_BLOCK records in turn and
+     *          append them in order, so memory use does not grow with the
+     *          roster. The file is written under a temporary name and
+     *          renamed into place.
+     */
+    bool writeFile(const std::string& path, unsigned threads = 1) const;
+};
+
+#endif // ROSTER_GENERATOR_H__
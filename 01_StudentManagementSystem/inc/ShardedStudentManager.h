@@ -0,0 +1,252 @@
+#ifndef SHARDED_STUDENT_MANAGER_H__
+#define SHARDED_STUDENT_MANAGER_H__
+
+#include "StudentManager.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * @class ShardedStudentManager
+ * @brief StudentManager split into independently locked shards
+ *
+ * @details A student lives in shard (ID % shard count). Each shard is a
+ *          StudentManager with its own reader/writer lock and indexes, so
+ *          adds, deletes and enrollments of students in different shards
+ *          never wait for each other. IDs come from one atomic counter;
+ *          since they are consecutive, new students go round-robin over the
+ *          shards. Each shard's store is built with the shard count as its
+ *          ID stride, so it keeps slots only for its own IDs and memory does
+ *          not grow with the number of shards.
+ *
+ *          Lookups by ID touch one shard. Searches, course queries, range
+ *          filters and counts ask every shard and merge the results, which
+ *          keep the order StudentManager documents for them. Every shard is
+ *          locked on its own, so a fan-out read running during mutations can
+ *          see some shards before and others after a change.
+ *
+ *          The interface matches StudentManager's except for journaling,
+ *          which needs one ordered log of all mutations.
+ */
+class ShardedStudentManager {
+private:
+    std::vector<std::unique_ptr<StudentManager>> shards;  ///< Shard i holds the IDs with ID % size == i
+    std::atomic<uint32_t> nextStudentId;                  ///< Counter for generating unique student IDs
+
+    StudentManager& shardFor(uint32_t studentId);
+    const StudentManager& shardFor(uint32_t studentId) const;
+
+public:
+    /**
+     * @brief Constructor
+     * @param shardCount Number of shards; 0 picks one per hardware thread
+     */
+    explicit ShardedStudentManager(size_t shardCount = 0);
+
+    /**
+     * @brief Gets the number of shards
+     * @return Shard count
+     */
+    size_t getShardCount() const;
+
+    // Student management operations
+    /**
+     * @brief Adds a new student to the system
+     * @param name The student's full name
+     * @param email The student's email address
+     * @param age The student's age
+     * @return true if student was successfully added, false otherwise
+     */
+    bool addStudent(const std::string& name, const std::string& email, uint8_t age);
+
+    /**
+     * @brief Adds a batch of existing students, keeping their IDs
+     * @param loaded Students to take over; the vector is left empty
+     * @return Number of students stored
+     * @details Splits the batch by shard and bulk loads each part; later
+     *          additions get IDs past the largest loaded one
+     */
+    uint32_t bulkLoadStudents(std::vector<Student>&& loaded);
+
+    /**
+     * @brief Removes a student from the system
+     * @param studentId The ID of the student to remove
+     * @return true if student was successfully removed, false if student wasn't found
+     */
+    bool deleteStudent(uint32_t studentId);
+
+    /**
+     * @brief Retrieves a student by their ID
+     * @param studentId The ID of the student to find
+     * @return Pointer to the Student object if found, nullptr otherwise
+     * @details The pointer is only valid until the next mutation of its shard
+     */
+    Student* getStudent(uint32_t studentId);
+
+    /**
+     * @brief Retrieves a copy of a student by their ID
+     * @param studentId The ID of the student to find
+     * @return The Student if found, std::nullopt otherwise
+     */
+    std::optional<Student> findStudent(uint32_t studentId) const;
+
+    /**
+     * @brief Searches for students by their name
+     * @param name Full or partial name to search for
+     * @return Vector of pointers to matching Student objects, in ID order
+     */
+    std::vector<Student*> searchStudentsByName(const std::string& name);
+
+    /**
+     * @brief Searches for students by their name, returning copies
+     * @param name Full or partial name to search for
+     * @return Copies of the matching students, in ID order
+     */
+    std::vector<Student> findStudentsByName(const std::string& name) const;
+
+    /**
+     * @brief Searches for students whose name starts with a prefix (type-ahead)
+     * @param prefix Beginning of the name, compared case-insensitively
+     * @param limit Maximum number of students to return
+     * @return Vector of pointers to at most limit matching Student objects,
+     *         ordered by case-folded name and then by ID
+     * @details Takes up to limit students from every shard and keeps the
+     *          first limit of the merged list
+     */
+    std::vector<Student*> searchStudentsByNamePrefix(const std::string& prefix, size_t limit = 10);
+
+    // Course management operations
+    /**
+     * @brief Enrolls a student in a course
+     * @param studentId The ID of the student to enroll
+     * @param course The name of the course
+     * @return true if enrollment was successful, false otherwise
+     */
+    bool enrollStudentInCourse(uint32_t studentId, const std::string& course);
+
+    /**
+     * @brief Removes a student from a course
+     * @param studentId The ID of the student
+     * @param course The name of the course
+     * @return true if removal was successful, false otherwise
+     */
+    bool removeStudentFromCourse(uint32_t studentId, const std::string& course);
+
+    /**
+     * @brief Lists the students enrolled in a course
+     * @param course The name of the course
+     * @return Vector of pointers to the enrolled Student objects, in ID order
+     */
+    std::vector<Student*> getStudentsInCourse(const std::string& course);
+
+    /**
+     * @brief Counts the students enrolled in a course
+     * @param course The name of the course
+     * @return Number of enrolled students, 0 for unknown courses
+     */
+    size_t getCourseEnrollmentCount(const std::string& course) const;
+
+    /**
+     * @brief Finds the students matching a course set-algebra query
+     * @param query Courses to combine
+     * @return Matching IDs in ascending order
+     */
+    std::vector<uint32_t> findStudentIdsByCourses(const CourseQuery& query) const;
+
+    /**
+     * @brief Counts the students matching a course set-algebra query
+     * @param query Courses to combine
+     * @return Number of matching students
+     */
+    size_t countStudentsByCourses(const CourseQuery& query) const;
+
+    // Utility functions
+    /**
+     * @brief Gets the total number of students in the system
+     * @return Number of enrolled students
+     */
+    uint32_t getStudentCount() const;
+
+    /**
+     * @brief Gets the course intern table shared by all students
+     * @return The process-wide CourseDictionary
+     */
+    static CourseDictionary& getCourseDictionary();
+
+    /**
+     * @brief Retrieves all students in the system
+     * @return Vector containing all Student objects, in ID order
+     */
+    std::vector<Student> getAllStudents() const;
+
+    /**
+     * @brief Calls a function for every student, one shard after another
+     * @param visit Callable taking a const Student&
+     * @details Nothing is copied. Students are in ID order within a shard
+     *          but not across shards. Each shard is visited as
+     *          StudentManager::forEachStudent() does, so the visitor must not
+     *          modify the manager unless snapshots are enabled.
+     */
+    template <typename Visitor>
+    void forEachStudent(Visitor&& visit) const {
+        for (const auto& shard : shards) {
+            shard->forEachStudent(visit);
+        }
+    }
+
+    /**
+     * @brief Turns multi-version snapshots on or off in every shard
+     * @param enabled true to maintain them, false to drop them
+     * @details Lets forEachStudent() walk each shard without holding its lock
+     */
+    void setSnapshotsEnabled(bool enabled);
+
+    /**
+     * @brief Checks whether multi-version snapshots are maintained
+     * @return true if they are enabled
+     */
+    bool isSnapshotsEnabled() const;
+
+    // Analytics
+    /**
+     * @brief Turns the columnar copy of the students on or off in every shard
+     * @param enabled true to build and maintain it, false to drop it
+     */
+    void setColumnarStoreEnabled(bool enabled);
+
+    /**
+     * @brief Checks whether the columnar copy is maintained
+     * @return true if it is enabled
+     */
+    bool isColumnarStoreEnabled() const;
+
+    /**
+     * @brief Finds the students whose age lies in a range
+     * @param minAge Smallest age to include
+     * @param maxAge Largest age to include
+     * @return Matching IDs in ascending order
+     */
+    std::vector<uint32_t> findStudentIdsByAgeRange(int minAge, int maxAge) const;
+
+    /**
+     * @brief Counts the students whose age lies in a range
+     * @param minAge Smallest age to include
+     * @param maxAge Largest age to include
+     * @return Number of matching students
+     */
+    size_t countStudentsByAgeRange(int minAge, int maxAge) const;
+
+    /**
+     * @brief Finds the students whose ID lies in a range
+     * @param firstId Smallest ID to include
+     * @param lastId Largest ID to include
+     * @return Matching IDs in ascending order
+     */
+    std::vector<uint32_t> findStudentIdsByIdRange(uint32_t firstId, uint32_t lastId) const;
+};
+
+#endif // SHARDED_STUDENT_MANAGER_H__
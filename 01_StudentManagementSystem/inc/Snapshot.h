@@ -0,0 +1,182 @@
+#ifndef SNAPSHOT_H__
+#define SNAPSHOT_H__
+
+#include "Student.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @file Snapshot.h
+ * @brief Versioned binary snapshot format for student data
+ *
+ * @details A snapshot file is laid out as:
+ *          - SnapshotHeader
+ *          - recordCount fixed-width SnapshotRecord entries, sorted by student ID
+ *          - courseCount SnapshotCourse entries (one per distinct course name)
+ *          - courseRefCount uint32_t indices into the course table; each record
+ *            owns courseCount consecutive entries starting at firstCourseRef
+ *          - the string table holding every name, email and course name
+ *
+ *          All integers are stored in host byte order (little-endian on every
+ *          platform this project targets). Readers reject files whose magic or
+ *          version do not match.
+ */
+
+constexpr char SNAPSHOT_MAGIC[8] = {'S', 'M', 'S', 'S', 'N', 'A', 'P', '\0'};
+constexpr uint32_t SNAPSHOT_VERSION = 1;
+
+/**
+ * @brief Fixed header at the start of every snapshot file
+ */
+struct SnapshotHeader {
+    char magic[8];                ///< SNAPSHOT_MAGIC
+    uint32_t version;             ///< SNAPSHOT_VERSION
+    uint32_t headerSize;          ///< sizeof(SnapshotHeader), for forward compatibility
+    uint64_t recordCount;         ///< Number of student records
+    uint64_t recordOffset;        ///< File offset of the record array
+    uint64_t courseCount;         ///< Number of distinct course names
+    uint64_t courseTableOffset;   ///< File offset of the course table
+    uint64_t courseRefCount;      ///< Total number of enrollments
+    uint64_t courseRefOffset;     ///< File offset of the course reference array
+    uint64_t stringTableOffset;   ///< File offset of the string table
+    uint64_t stringTableSize;     ///< Size of the string table in bytes
+};
+
+/**
+ * @brief One student in a snapshot
+ */
+struct SnapshotRecord {
+    uint32_t studentId;       ///< Student ID
+    int32_t age;              ///< Student age
+    uint32_t nameLength;      ///< Length of the name in the string table
+    uint32_t emailLength;     ///< Length of the email in the string table
+    uint64_t nameOffset;      ///< Offset of the name in the string table
+    uint64_t emailOffset;     ///< Offset of the email in the string table
+    uint64_t firstCourseRef;  ///< Index of the first course reference
+    uint32_t courseCount;     ///< Number of course references
+    uint32_t reserved;        ///< Always 0
+};
+
+/**
+ * @brief One distinct course name in a snapshot
+ */
+struct SnapshotCourse {
+    uint64_t offset;          ///< Offset of the name in the string table
+    uint32_t length;          ///< Length of the name
+    uint32_t reserved;        ///< Always 0
+};
+
+static_assert(sizeof(SnapshotHeader) == 80, "SnapshotHeader layout changed");
+static_assert(sizeof(SnapshotRecord) == 48, "SnapshotRecord layout changed");
+static_assert(sizeof(SnapshotCourse) == 16, "SnapshotCourse layout changed");
+
+/**
+ * @brief Write students to a snapshot file
+ * @param filePath Destination path
+ * @param students Students to write, in any order
+ * @return true if the snapshot was written, false otherwise
+ * @details The file is written next to its destination, synced and renamed
+ *          into place, so readers never see a partially written snapshot and
+ *          the snapshot survives a crash once this returns true.
+ */
+bool writeSnapshot(const std::string& filePath, const std::vector<Student>& students);
+
+/**
+ * @brief Write students to a snapshot file without copying them
+ * @param filePath Destination path
+ * @param students Students to write, in ascending ID order
+ * @return true if the snapshot was written, false otherwise
+ */
+bool writeSortedSnapshot(const std::string& filePath, const std::vector<const Student*>& students);
+
+/**
+ * @class SnapshotView
+ * @brief Read-only accessor over the bytes of a snapshot
+ *
+ * @details The view does not own the bytes. attach() validates the header and
+ *          section bounds only, so attaching is constant time; individual
+ *          records are bounds-checked when they are accessed.
+ */
+class SnapshotView {
+private:
+    const SnapshotRecord* records;    ///< Record array inside the snapshot
+    const SnapshotCourse* courses;    ///< Course table inside the snapshot
+    const uint32_t* courseRefs;       ///< Course reference array inside the snapshot
+    const char* strings;              ///< String table inside the snapshot
+    SnapshotHeader header;            ///< Copy of the validated header
+
+    std::string_view stringAt(uint64_t offset, uint64_t length) const;
+
+public:
+    /**
+     * @brief Default constructor
+     * @details Creates an empty, detached view
+     */
+    SnapshotView();
+
+    /**
+     * @brief Attach the view to snapshot bytes
+     * @param bytes Start of the snapshot, must stay valid while the view is used
+     * @param size Number of bytes available
+     * @return true if the header and sections are valid, false otherwise
+     */
+    bool attach(const char* bytes, std::size_t size);
+
+    /**
+     * @brief Get the number of student records
+     * @return Record count, 0 for a detached view
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Get a raw record
+     * @param index Record index, less than size()
+     * @return Reference to the record inside the snapshot
+     */
+    const SnapshotRecord& record(std::size_t index) const;
+
+    /**
+     * @brief Get the name of a record
+     * @param index Record index, less than size()
+     * @return Name bytes inside the snapshot
+     * @throws std::out_of_range if the record points outside the string table
+     */
+    std::string_view name(std::size_t index) const;
+
+    /**
+     * @brief Get the email of a record
+     * @param index Record index, less than size()
+     * @return Email bytes inside the snapshot
+     * @throws std::out_of_range if the record points outside the string table
+     */
+    std::string_view email(std::size_t index) const;
+
+    /**
+     * @brief Get one course name of a record
+     * @param index Record index, less than size()
+     * @param course Course position, less than record(index).courseCount
+     * @return Course name bytes inside the snapshot
+     * @throws std::out_of_range if the record or course reference is invalid
+     */
+    std::string_view course(std::size_t index, std::size_t course) const;
+
+    /**
+     * @brief Find a record by student ID
+     * @param studentId ID to look for
+     * @return Index of the record, or size() if there is none
+     * @details Binary search over the ID-sorted record array
+     */
+    std::size_t find(uint32_t studentId) const;
+
+    /**
+     * @brief Build a Student from a record
+     * @param index Record index, less than size()
+     * @return The materialized Student, including its courses
+     */
+    Student materialize(std::size_t index) const;
+};
+
+#endif // SNAPSHOT_H__
@@ -0,0 +1,60 @@
+#ifndef STRING_SEARCH_H__
+#define STRING_SEARCH_H__
+
+#include <string_view>
+
+/**
+ * @file StringSearch.h
+ * @brief Case-insensitive substring search used by the name searches
+ *
+ * @details ASCII letters are folded to lower case on the fly, other bytes are
+ *          compared as they are; this matches std::tolower in the "C" locale.
+ *          Nothing is allocated.
+ *
+ *          On x86 the search compares 16 (SSE2) or 32 (AVX2) candidate
+ *          positions at once: it looks for positions where both the first and
+ *          the last byte of the needle match and only compares the bytes in
+ *          between for those. The widest kernel the CPU supports is picked at
+ *          runtime; other platforms use the scalar kernel.
+ */
+
+/**
+ * @brief Implementations of the search
+ */
+enum class StringSearchKernel {
+    Scalar,   ///< Byte-at-a-time, available everywhere
+    Sse2,     ///< 16 positions per step, x86 only
+    Avx2      ///< 32 positions per step, x86 CPUs with AVX2 only
+};
+
+/**
+ * @brief Check whether text contains pattern, ignoring ASCII case
+ * @param text Text to search in
+ * @param pattern Text to search for; an empty pattern matches everything
+ * @return true if pattern occurs in text
+ */
+bool containsIgnoreCase(std::string_view text, std::string_view pattern);
+
+/**
+ * @brief Check whether text contains pattern with a specific kernel
+ * @param text Text to search in
+ * @param pattern Text to search for
+ * @param kernel Kernel to use; an unsupported one falls back to the next narrower kernel
+ * @return true if pattern occurs in text
+ */
+bool containsIgnoreCase(std::string_view text, std::string_view pattern, StringSearchKernel kernel);
+
+/**
+ * @brief Get the kernel containsIgnoreCase(text, pattern) uses on this CPU
+ * @return The fastest supported kernel
+ */
+StringSearchKernel activeStringSearchKernel();
+
+/**
+ * @brief Check whether a kernel can run on this CPU
+ * @param kernel Kernel to check
+ * @return true if the kernel is compiled in and supported by the CPU
+ */
+bool isStringSearchKernelSupported(StringSearchKernel kernel);
+
+#endif // STRING_SEARCH_H__
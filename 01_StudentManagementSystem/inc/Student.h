@@ -1,7 +1,11 @@
 #ifndef STUDENT_H__
 #define STUDENT_H__
 
+#include "CourseDictionary.h"
+#include <cstdint>
+#include <iosfwd>
 #include <string>
+#include <string_view>
 #include <vector>
 
 /**
@@ -9,7 +13,8 @@
  * @brief Represents a student in the school system.
  *
  * @details This class encapsulates the details of a student such as their ID, name, email,
- * age, and enrolled courses.
+ * age, and enrolled courses. Courses are kept as IDs from the shared
+ * CourseDictionary; the name based methods translate at the boundary.
  */
 class Student {
 private:
@@ -17,7 +22,7 @@ private:
     std::string name;        ///< Full name of the student
     std::string email;       ///< Email address of the student
     int age;                 ///< Age of the student
-    std::vector<std::string> courses;  ///< List of courses the student is enrolled in
+    std::vector<uint32_t> courseIds;  ///< CourseDictionary IDs of the enrolled courses, in enrollment order
 
 public:
     /**
@@ -31,8 +36,10 @@ public:
      * @param name The student's full name
      * @param email The student's email address
      * @param age The student's age
+     * @details Name and email are taken by value so callers can move
+     *          freshly parsed strings in without a second copy
      */
-    Student(int id, const std::string& name, const std::string& email, int age);
+    Student(int id, std::string name, std::string email, int age);
     
     // Getters
     /**
@@ -43,15 +50,15 @@ public:
 
     /**
      * @brief Get the student's name
-     * @return The student's full name
+     * @return The student's full name, valid until the name is changed
      */
-    std::string getName() const;
+    const std::string& getName() const;
 
     /**
      * @brief Get the student's email
-     * @return The student's email address
+     * @return The student's email address, valid until the email is changed
      */
-    std::string getEmail() const;
+    const std::string& getEmail() const;
 
     /**
      * @brief Get the student's age
@@ -62,8 +69,30 @@ public:
     /**
      * @brief Get the list of courses
      * @return Vector containing all enrolled courses
+     * @details Builds a new vector of names; forEachCourse() visits the
+     *          names without copying them
      */
     std::vector<std::string> getCourses() const;
+
+    /**
+     * @brief Call a function for every enrolled course name
+     * @param visit Callable taking a const std::string&
+     * @details Names are read from the CourseDictionary in enrollment order
+     *          without allocating
+     */
+    template <typename Visitor>
+    void forEachCourse(Visitor&& visit) const {
+        const CourseDictionary& dictionary = CourseDictionary::instance();
+        for (uint32_t courseId : courseIds) {
+            visit(dictionary.name(courseId));
+        }
+    }
+
+    /**
+     * @brief Get the IDs of the enrolled courses
+     * @return CourseDictionary IDs in enrollment order
+     */
+    const std::vector<uint32_t>& getCourseIds() const;
     
     // Setters
     /**
@@ -95,20 +124,39 @@ public:
      * @brief Add a course to student's enrollment list
      * @param course Name of the course to add
      */
-    void addCourse(const std::string& course);
+    void addCourse(std::string_view course);
+
+    /**
+     * @brief Add a course to student's enrollment list by ID
+     * @param courseId CourseDictionary ID of the course to add
+     */
+    void addCourseId(uint32_t courseId);
 
     /**
      * @brief Remove a course from student's enrollment list
      * @param course Name of the course to remove
      */
-    void removeCourse(const std::string& course);
+    void removeCourse(std::string_view course);
+
+    /**
+     * @brief Remove a course from student's enrollment list by ID
+     * @param courseId CourseDictionary ID of the course to remove
+     */
+    void removeCourseId(uint32_t courseId);
 
     /**
      * @brief Check if student is enrolled in a specific course
      * @param course Name of the course to check
      * @return true if student is enrolled, false otherwise
      */
-    bool isEnrolledIn(const std::string& course) const;
+    bool isEnrolledIn(std::string_view course) const;
+
+    /**
+     * @brief Check if student is enrolled in a course given by ID
+     * @param courseId CourseDictionary ID of the course to check
+     * @return true if student is enrolled, false otherwise
+     */
+    bool isEnrolledInCourseId(uint32_t courseId) const;
     
     /**
      * @brief Convert student information to string format
@@ -117,4 +165,12 @@ public:
     std::string toString() const;
 };
 
+/**
+ * @brief Write student information in the toString() format
+ * @param out Stream to write to
+ * @param student Student to write
+ * @return The stream
+ */
+std::ostream& operator<<(std::ostream& out, const Student& student);
+
 #endif // STUDENT_H__
@@ -1,25 +1,81 @@
 #ifndef STUDENT_MANAGER_H__
 #define STUDENT_MANAGER_H__
 
+#include "ColumnarStudentStore.h"
+#include "CourseDictionary.h"
+#include "CourseIndex.h"
+#include "NamePrefixIndex.h"
+#include "OperationMetrics.h"
 #include "Student.h"
-#include <map>
+#include "StudentStore.h"
+#include "TrigramIndex.h"
+#include "VersionedStudentStore.h"
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <utility>
 #include <vector>
 #include <string>
 
+class Journal;
+
+/**
+ * @struct CourseQuery
+ * @brief Set-algebra query over course enrollments
+ *
+ * @details Selects the students enrolled in every course of allOf, in at
+ *          least one course of anyOf, and in no course of noneOf. Empty
+ *          lists place no restriction.
+ */
+struct CourseQuery {
+    std::vector<std::string> allOf;   ///< Courses a student must all be enrolled in (AND)
+    std::vector<std::string> anyOf;   ///< Courses of which a student needs at least one (OR)
+    std::vector<std::string> noneOf;  ///< Courses a student must not be enrolled in (AND NOT)
+};
+
 /**
  * @class StudentManager
  * @brief Manages student records and their course enrollments
  * 
  * @details This class provides functionality to:
  *          - Add and remove students
- *          - Search for students
- *          - Manage course enrollments
+ *          - Search for students (substring name search backed by a trigram index,
+ *            prefix search backed by a sorted name index)
+ *          - Manage course enrollments (courses are interned in the shared
+ *            CourseDictionary, students keep integer course IDs) and list
+ *            the students of a course from an inverted index
+ *          - Filter by age or ID range, optionally over a columnar copy
  *          - Track student information
+ *          - Log every mutation to an attached Journal
+ *
+ *          All members are safe to call from several threads. Reads share a
+ *          reader/writer lock and run in parallel; mutations take it
+ *          exclusively and are applied one at a time. Methods returning
+ *          Student pointers hand out references into the store, which stay
+ *          valid only until the next mutation from any thread; concurrent
+ *          callers should use findStudent() and findStudentsByName(), which
+ *          return copies.
+ *
+ *          With snapshots enabled the manager also keeps a copy-on-write
+ *          version of the students; snapshot() returns a point-in-time view
+ *          in O(1), and full scans read such a view instead of holding the
+ *          lock, so writers only wait for the view to be taken.
  */
 class StudentManager {
 private:
-    std::map<uint32_t, Student> students; ///< Map of student ID to Student object
+    StudentStore students;                ///< Student ID to Student storage (see StudentStore.h)
     uint32_t nextStudentId;               ///< Counter for generating unique student IDs
+    TrigramIndex nameIndex;               ///< Trigram index over student names
+    NamePrefixIndex prefixIndex;          ///< Sorted folded names for prefix search
+    CourseIndex courseIndex;              ///< Course -> bitmap of enrolled student IDs
+    std::unique_ptr<ColumnarStudentStore> columns; ///< Columnar copy for scans, nullptr if disabled
+    std::unique_ptr<VersionedStudentStore> versions; ///< Copy-on-write versions for snapshots, nullptr if disabled
+    Journal* journal;                     ///< Journal receiving mutations, nullptr if none
+    mutable std::shared_mutex mutex;      ///< Shared for reads, exclusive for mutations
+
+    std::vector<uint32_t> matchStudentIdsByName(const std::string& name) const;
+    RoaringBitmap evaluateCourseQuery(const CourseQuery& query) const;
 
 public:
     /**
@@ -27,6 +83,16 @@ public:
      * @details Initializes an empty student management system
      */
     StudentManager();
+
+    /**
+     * @brief Constructor for a manager holding every idStride-th ID
+     * @param idStride Distance between the IDs this manager will hold
+     * @details Used for the shards of a ShardedStudentManager, which each
+     *          receive the IDs of one residue class; the store then keeps one
+     *          slot per held ID instead of one per ID of the whole range.
+     *          Any ID can still be stored, only less compactly.
+     */
+    explicit StudentManager(uint32_t idStride);
     
     // Student management operations
     /**
@@ -35,13 +101,31 @@ public:
      * @param email The student's email address
      * @param age The student's age
      * @return true if student was successfully added, false otherwise
+     * @details With a journal attached, false also means the change was made
+     *          in memory but the commit the DurabilityPolicy requires failed,
+     *          so it may not survive a crash
      */
     bool addStudent(const std::string& name, const std::string& email, uint8_t age);
 
+    /**
+     * @brief Adds a batch of existing students, keeping their IDs
+     * @param loaded Students to take over; the vector is left empty
+     * @return Number of students stored
+     * @details Intended for loading saved data. Records are inserted in ID
+     *          order, so a sorted batch into an empty manager is built in
+     *          linear time. A record whose ID is already
+     *          present replaces the existing student. nextStudentId is moved
+     *          past the largest ID so later additions never collide.
+     */
+    uint32_t bulkLoadStudents(std::vector<Student>&& loaded);
+
     /**
      * @brief Removes a student from the system
      * @param studentId The ID of the student to remove
      * @return true if student was successfully removed, false if student wasn't found
+     * @details With a journal attached, false also means the change was made
+     *          in memory but the commit the DurabilityPolicy requires failed,
+     *          so it may not survive a crash
      */
     bool deleteStudent(uint32_t studentId);
 
@@ -49,15 +133,45 @@ public:
      * @brief Retrieves a student by their ID
      * @param studentId The ID of the student to find
      * @return Pointer to the Student object if found, nullptr otherwise
+     * @details The pointer is only valid until the next mutation
      */
     Student* getStudent(uint32_t studentId);
 
+    /**
+     * @brief Retrieves a copy of a student by their ID
+     * @param studentId The ID of the student to find
+     * @return The Student if found, std::nullopt otherwise
+     * @details Safe to use while other threads modify the manager
+     */
+    std::optional<Student> findStudent(uint32_t studentId) const;
+
     /**
      * @brief Searches for students by their name
      * @param name Full or partial name to search for
-     * @return Vector of pointers to matching Student objects
+     * @return Vector of pointers to matching Student objects, in ID order
+     * @details Case-insensitive substring match. Queries of three or more
+     *          characters are answered from the trigram index.
      */
     std::vector<Student*> searchStudentsByName(const std::string& name);
+
+    /**
+     * @brief Searches for students by their name, returning copies
+     * @param name Full or partial name to search for
+     * @return Copies of the matching students, in ID order
+     * @details Same matching as searchStudentsByName(); safe to use while
+     *          other threads modify the manager
+     */
+    std::vector<Student> findStudentsByName(const std::string& name) const;
+
+    /**
+     * @brief Searches for students whose name starts with a prefix (type-ahead)
+     * @param prefix Beginning of the name, compared case-insensitively
+     * @param limit Maximum number of students to return
+     * @return Vector of pointers to at most limit matching Student objects,
+     *         ordered by case-folded name and then by ID
+     * @details Runs in O(log n + limit) and never looks at matches past the limit
+     */
+    std::vector<Student*> searchStudentsByNamePrefix(const std::string& prefix, size_t limit = 10);
     
     // Course management operations
     /**
@@ -65,6 +179,9 @@ public:
      * @param studentId The ID of the student to enroll
      * @param course The name of the course
      * @return true if enrollment was successful, false otherwise
+     * @details With a journal attached, false also means the change was made
+     *          in memory but the commit the DurabilityPolicy requires failed,
+     *          so it may not survive a crash
      */
     bool enrollStudentInCourse(uint32_t studentId, const std::string& course);
 
@@ -73,8 +190,43 @@ public:
      * @param studentId The ID of the student
      * @param course The name of the course
      * @return true if removal was successful, false otherwise
+     * @details With a journal attached, false also means the change was made
+     *          in memory but the commit the DurabilityPolicy requires failed,
+     *          so it may not survive a crash
      */
     bool removeStudentFromCourse(uint32_t studentId, const std::string& course);
+
+    /**
+     * @brief Lists the students enrolled in a course
+     * @param course The name of the course
+     * @return Vector of pointers to the enrolled Student objects, in ID order
+     * @details Answered from the course index in time proportional to the
+     *          number of enrolled students
+     */
+    std::vector<Student*> getStudentsInCourse(const std::string& course);
+
+    /**
+     * @brief Counts the students enrolled in a course
+     * @param course The name of the course
+     * @return Number of enrolled students, 0 for unknown courses
+     */
+    size_t getCourseEnrollmentCount(const std::string& course) const;
+
+    /**
+     * @brief Finds the students matching a course set-algebra query
+     * @param query Courses to combine
+     * @return Matching IDs in ascending order
+     * @details Evaluated on the course index bitmaps; only a query without
+     *          allOf and anyOf courses visits every student
+     */
+    std::vector<uint32_t> findStudentIdsByCourses(const CourseQuery& query) const;
+
+    /**
+     * @brief Counts the students matching a course set-algebra query
+     * @param query Courses to combine
+     * @return Number of matching students
+     */
+    size_t countStudentsByCourses(const CourseQuery& query) const;
     
     // Utility functions
     /**
@@ -83,11 +235,142 @@ public:
      */
     uint32_t getStudentCount() const;
 
+    /**
+     * @brief Gets the course intern table shared by all students
+     * @return The process-wide CourseDictionary
+     */
+    static CourseDictionary& getCourseDictionary();
+
+    /**
+     * @brief Gets the call counts and latency histograms of the instrumented operations
+     * @return Report summed over all threads, printable with toText() or toJson()
+     * @details Process-wide like the course dictionary: it covers every
+     *          StudentManager and FileManager. Empty when the library is
+     *          built without SMS_ENABLE_METRICS.
+     */
+    static MetricsReport getStats();
+
     /**
      * @brief Retrieves all students in the system
      * @return Vector containing all Student objects
+     * @details Copies every student; forEachStudent() visits them in place.
+     *          With snapshots enabled the copying runs without the lock.
      */
     std::vector<Student> getAllStudents() const;
+
+    /**
+     * @brief Calls a function for every student, in ascending ID order
+     * @param visit Callable taking a const Student&
+     * @details Nothing is copied. With snapshots enabled the visit walks a
+     *          snapshot without the lock, so mutations (also from the visitor)
+     *          proceed and are not seen. Otherwise it holds the shared lock,
+     *          other threads' mutations wait for it and the visitor itself
+     *          must not modify the manager.
+     */
+    template <typename Visitor>
+    void forEachStudent(Visitor&& visit) const {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        if (versions) {
+            StudentSnapshot view = versions->snapshot();
+            lock.unlock();
+            view.forEach(std::forward<Visitor>(visit));
+            return;
+        }
+        students.forEach(std::forward<Visitor>(visit));
+    }
+
+    /**
+     * @brief Takes a point-in-time view of the students
+     * @return Snapshot that later mutations do not change; it can be read
+     *         from any thread without locking
+     * @details O(1) with snapshots enabled, a copy of every student otherwise.
+     *          Versions are freed when the last snapshot using them is gone.
+     */
+    StudentSnapshot snapshot() const;
+
+    /**
+     * @brief Takes a point-in-time view of the students and the journal position it matches
+     * @param journalSequence Receives the sequence number of the last journal
+     *        record the view contains, 0 without a journal
+     * @return Snapshot that later mutations do not change
+     * @details Mutations are journaled under the exclusive lock, so reading
+     *          both under the shared lock gives a consistent checkpoint: every
+     *          record after journalSequence is missing from the view.
+     */
+    StudentSnapshot snapshot(uint64_t& journalSequence) const;
+
+    /**
+     * @brief Turns multi-version snapshots on or off
+     * @param enabled true to build the versioned copy from the current
+     *                students and keep it up to date, false to drop it
+     * @details Each mutation then also stores a new immutable version of the
+     *          student, copying tree nodes an outstanding snapshot still uses
+     */
+    void setSnapshotsEnabled(bool enabled);
+
+    /**
+     * @brief Checks whether multi-version snapshots are maintained
+     * @return true if they are enabled
+     */
+    bool isSnapshotsEnabled() const;
+
+    // Analytics
+    /**
+     * @brief Turns the columnar copy of the students on or off
+     * @param enabled true to build it from the current students and keep it
+     *                up to date, false to drop it
+     * @details The copy costs memory and a little time per mutation; range
+     *          filters read it instead of the Student objects when it exists
+     */
+    void setColumnarStoreEnabled(bool enabled);
+
+    /**
+     * @brief Checks whether the columnar copy is maintained
+     * @return true if it is enabled
+     */
+    bool isColumnarStoreEnabled() const;
+
+    /**
+     * @brief Finds the students whose age lies in a range
+     * @param minAge Smallest age to include
+     * @param maxAge Largest age to include
+     * @return Matching IDs in ascending order
+     */
+    std::vector<uint32_t> findStudentIdsByAgeRange(int minAge, int maxAge) const;
+
+    /**
+     * @brief Counts the students whose age lies in a range
+     * @param minAge Smallest age to include
+     * @param maxAge Largest age to include
+     * @return Number of matching students
+     */
+    size_t countStudentsByAgeRange(int minAge, int maxAge) const;
+
+    /**
+     * @brief Finds the students whose ID lies in a range
+     * @param firstId Smallest ID to include
+     * @param lastId Largest ID to include
+     * @return Matching IDs in ascending order
+     */
+    std::vector<uint32_t> findStudentIdsByIdRange(uint32_t firstId, uint32_t lastId) const;
+
+    // Persistence
+    /**
+     * @brief Attach a journal that records every successful mutation
+     * @param journal Journal to append to, or nullptr to stop journaling
+     * @details bulkLoadStudents is not journaled, it is meant for loading
+     *          data that is already persisted. Each mutation is committed
+     *          according to the journal's DurabilityPolicy before it returns;
+     *          the commit waits outside the lock so concurrent writers can
+     *          share a group commit.
+     */
+    void setJournal(Journal* journal);
+
+    /**
+     * @brief Get the attached journal
+     * @return The attached journal, nullptr if none
+     */
+    Journal* getJournal() const;
 };
 
 #endif // STUDENT_MANAGER_H__
\ No newline at end of file
@@ -0,0 +1,227 @@
+#ifndef STUDENT_STORE_H__
+#define STUDENT_STORE_H__
+
+#include "Student.h"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <optional>
+
+/**
+ * @file StudentStore.h
+ * @brief Storage backends for StudentManager, keyed by student ID
+ *
+ * @details Both stores offer the same interface:
+ *          - find(id) returns a pointer to the stored Student or nullptr
+ *          - insertOrAssign(id, student) stores or replaces a Student
+ *          - erase(id), size(), clear()
+ *          - forEach(fn) visits every Student in ascending ID order
+ *
+ *          Pointers returned by find() stay valid until that student is erased,
+ *          whatever else is inserted or erased, because StudentManager hands
+ *          them out from getStudent() and the search functions.
+ *
+ *          Both are constructed with an ID stride: the distance between the
+ *          IDs the store will hold, 1 for consecutive IDs. Only the dense
+ *          store uses it.
+ *
+ *          StudentManager uses DenseStudentStore unless the project is built
+ *          with SMS_USE_MAP_STORAGE, which selects the std::map based store.
+ */
+
+/**
+ * @class MapStudentStore
+ * @brief Student storage in a std::map, one tree node per student
+ */
+class MapStudentStore {
+private:
+    std::map<uint32_t, Student> students;   ///< Students by ID
+
+public:
+    /**
+     * @brief Constructor
+     * @param idStride Distance between the IDs to store; unused, a tree has no slots
+     */
+    explicit MapStudentStore(uint32_t idStride = 1);
+
+    /**
+     * @brief Find a student
+     * @param studentId ID to look for
+     * @return Pointer to the stored Student, nullptr if there is none
+     */
+    Student* find(uint32_t studentId);
+    const Student* find(uint32_t studentId) const;
+
+    /**
+     * @brief Store a student, replacing any student with the same ID
+     * @param studentId ID to store the student under
+     * @param student Student to take over
+     * @return Reference to the stored Student
+     */
+    Student& insertOrAssign(uint32_t studentId, Student&& student);
+
+    /**
+     * @brief Remove a student
+     * @param studentId ID of the student to remove
+     * @return true if a student was removed, false if there was none
+     */
+    bool erase(uint32_t studentId);
+
+    /**
+     * @brief Get the number of stored students
+     * @return Student count
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Remove every student
+     */
+    void clear();
+
+    /**
+     * @brief Visit every student in ascending ID order
+     * @param visit Callable taking (Student&) or (const Student&)
+     */
+    template <typename Visitor>
+    void forEach(Visitor&& visit) {
+        for (auto& pair : students) {
+            visit(pair.second);
+        }
+    }
+
+    template <typename Visitor>
+    void forEach(Visitor&& visit) const {
+        for (const auto& pair : students) {
+            visit(pair.second);
+        }
+    }
+};
+
+/**
+ * @class DenseStudentStore
+ * @brief Student storage in ID-indexed slots
+ *
+ * @details IDs handed out by StudentManager are consecutive, so the students
+ *          live in a std::deque of optional slots where slot i holds ID
+ *          baseId + i * stride. A lookup is an index computation and two memory reads
+ *          instead of a walk down a tree. The deque grows at either end
+ *          without moving existing slots, so Student pointers stay valid.
+ *
+ *          The stride is 1 for a StudentManager holding consecutive IDs. A
+ *          shard of a ShardedStudentManager holds every n-th ID and uses
+ *          stride n, so its slots cover only its own IDs instead of n times
+ *          as many mostly empty slots.
+ *
+ *          An ID further than MAX_GAP slots away from the current range would
+ *          force many empty slots; such IDs go to a small overflow std::map
+ *          instead, as does an ID that is not a multiple of the stride away
+ *          from baseId. Every ID lives in exactly one of the two places.
+ */
+class DenseStudentStore {
+private:
+    std::deque<std::optional<Student>> slots;   ///< Slot i holds ID baseId + i * stride
+    uint32_t baseId;                             ///< ID of slots.front()
+    uint32_t stride;                             ///< ID distance between neighbouring slots
+    std::size_t count;                           ///< Engaged slots plus overflow entries
+    std::map<uint32_t, Student> overflow;        ///< IDs outside the dense range
+
+    std::optional<Student>* slotFor(uint32_t studentId);
+    const std::optional<Student>* slotFor(uint32_t studentId) const;
+    void trim();
+
+public:
+    /// Largest run of empty slots the dense range grows by to reach a new ID
+    static constexpr uint32_t MAX_GAP = 4096;
+
+    /**
+     * @brief Constructor
+     * @param idStride Distance between the IDs to store, at least 1
+     * @details Creates an empty store
+     */
+    explicit DenseStudentStore(uint32_t idStride = 1);
+
+    /**
+     * @brief Find a student
+     * @param studentId ID to look for
+     * @return Pointer to the stored Student, nullptr if there is none
+     */
+    Student* find(uint32_t studentId);
+    const Student* find(uint32_t studentId) const;
+
+    /**
+     * @brief Store a student, replacing any student with the same ID
+     * @param studentId ID to store the student under
+     * @param student Student to take over
+     * @return Reference to the stored Student
+     */
+    Student& insertOrAssign(uint32_t studentId, Student&& student);
+
+    /**
+     * @brief Remove a student
+     * @param studentId ID of the student to remove
+     * @return true if a student was removed, false if there was none
+     * @details Empty slots at either end of the range are released
+     */
+    bool erase(uint32_t studentId);
+
+    /**
+     * @brief Get the number of stored students
+     * @return Student count
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Remove every student
+     */
+    void clear();
+
+    /**
+     * @brief Visit every student in ascending ID order
+     * @param visit Callable taking (Student&) or (const Student&)
+     * @details Merges the dense slots with the overflow map by ID
+     */
+    template <typename Visitor>
+    void forEach(Visitor&& visit) {
+        auto far = overflow.begin();
+        for (std::size_t i = 0; i < slots.size(); ++i) {
+            if (!slots[i]) {
+                continue;
+            }
+            uint32_t id = baseId + static_cast<uint32_t>(i) * stride;
+            for (; far != overflow.end() && far->first < id; ++far) {
+                visit(far->second);
+            }
+            visit(*slots[i]);
+        }
+        for (; far != overflow.end(); ++far) {
+            visit(far->second);
+        }
+    }
+
+    template <typename Visitor>
+    void forEach(Visitor&& visit) const {
+        auto far = overflow.begin();
+        for (std::size_t i = 0; i < slots.size(); ++i) {
+            if (!slots[i]) {
+                continue;
+            }
+            uint32_t id = baseId + static_cast<uint32_t>(i) * stride;
+            for (; far != overflow.end() && far->first < id; ++far) {
+                visit(far->second);
+            }
+            visit(*slots[i]);
+        }
+        for (; far != overflow.end(); ++far) {
+            visit(far->second);
+        }
+    }
+};
+
+#ifdef SMS_USE_MAP_STORAGE
+using StudentStore = MapStudentStore;
+#else
+using StudentStore = DenseStudentStore;
+#endif
+
+#endif // STUDENT_STORE_H__
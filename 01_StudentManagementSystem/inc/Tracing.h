@@ -0,0 +1,151 @@
+#ifndef TRACING_H__
+#define TRACING_H__
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief One finished span
+ */
+struct TraceEvent {
+    const char* name;        ///< Span name, a string literal
+    const char* argName;     ///< Name of the optional argument, null when there is none
+    uint64_t startNanos;     ///< Start on the steady clock
+    uint64_t durationNanos;  ///< Length of the span
+    uint64_t argValue;       ///< Value of the optional argument
+};
+
+/**
+ * @brief Events recorded by one thread
+ * @details Only the owning thread appends. It fills the slot, then
+ *          publishes it by storing the new count with release order, so a
+ *          reader that loads count with acquire order can read every event
+ *          below it without a lock. Events live in chunks allocated on
+ *          demand and kept for the life of the thread.
+ */
+struct TraceThreadBuffer {
+    static constexpr size_t CHUNK_EVENTS = 16384;
+    static constexpr size_t MAX_CHUNKS = 64;
+    static constexpr size_t MAX_EVENTS = CHUNK_EVENTS * MAX_CHUNKS;  ///< Later events of a session are dropped
+
+    std::array<std::atomic<TraceEvent*>, MAX_CHUNKS> chunks{};  ///< Event storage
+    std::atomic<uint64_t> session{0};                            ///< Session the events belong to
+    std::atomic<size_t> count{0};                                ///< Published events
+    std::atomic<uint64_t> dropped{0};                            ///< Events that did not fit
+    std::atomic<bool> finished{false};                           ///< The thread has exited
+    uint32_t threadId = 0;                                       ///< tid in the trace
+
+    TraceThreadBuffer() = default;
+    ~TraceThreadBuffer();
+    TraceThreadBuffer(const TraceThreadBuffer&) = delete;
+    TraceThreadBuffer& operator=(const TraceThreadBuffer&) = delete;
+};
+
+/// Buffer of the calling thread, null until its first recorded span
+inline thread_local TraceThreadBuffer* currentTraceBuffer = nullptr;
+
+/**
+ * @class Tracer
+ * @brief Records scoped spans and writes them as Chrome trace-event JSON
+ *
+ * @details Tracing is off until start() is called, or until the process
+ *          starts with the SMS_TRACE_FILE environment variable naming the
+ *          output file. A span costs one relaxed load while tracing is off.
+ *          While it is on, each thread appends to its own buffer without
+ *          locking; stop() gathers the buffers of all threads, including
+ *          threads that have exited, and writes a file that chrome://tracing
+ *          and Perfetto open. A session still running at exit is written
+ *          then.
+ */
+class Tracer {
+private:
+    static inline std::atomic<bool> enabled{false};
+    static inline std::atomic<uint64_t> session{0};
+
+    static TraceThreadBuffer* registerThread();
+
+public:
+    /**
+     * @brief Start recording spans
+     * @param path File the trace is written to by stop()
+     * @return false if a session is already running
+     */
+    static bool start(const std::string& path);
+
+    /**
+     * @brief Stop recording and write the trace file
+     * @return true if a session was running and its file was written
+     */
+    static bool stop();
+
+    /**
+     * @brief Check whether spans are being recorded
+     * @return true while a session is running
+     */
+    static bool isEnabled() {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Read the clock spans are timed with
+     * @return Steady clock time in nanoseconds
+     */
+    static uint64_t now() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    /**
+     * @brief Append a finished span to the calling thread's buffer
+     * @param event The span
+     */
+    static void record(const TraceEvent& event);
+};
+
+/**
+ * @class TraceSpan
+ * @brief Records the time from its construction to the end of the scope as a span
+ * @details Does nothing if tracing was off when it was constructed.
+ */
+class TraceSpan {
+private:
+    TraceEvent event;
+
+public:
+    /**
+     * @brief Start a span
+     * @param name Span name; must be a string literal without quotes or backslashes
+     */
+    explicit TraceSpan(const char* name) : event{nullptr, nullptr, 0, 0, 0} {
+        if (Tracer::isEnabled()) {
+            event.name = name;
+            event.startNanos = Tracer::now();
+        }
+    }
+
+    ~TraceSpan() {
+        if (event.name) {
+            event.durationNanos = Tracer::now() - event.startNanos;
+            Tracer::record(event);
+        }
+    }
+
+    /**
+     * @brief Attach a number to the span, shown under its args
+     * @param name Argument name; must be a string literal without quotes or backslashes
+     * @param value Argument value
+     */
+    void setArg(const char* name, uint64_t value) {
+        event.argName = name;
+        event.argValue = value;
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+};
+
+#endif // TRACING_H__
@@ -0,0 +1,86 @@
+#ifndef TRIGRAM_INDEX_H__
+#define TRIGRAM_INDEX_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class TrigramIndex
+ * @brief Inverted index from case-folded trigrams to student IDs
+ *
+ * @details Every name is folded to lower case and split into its overlapping
+ *          3-byte substrings. For each distinct trigram the index keeps a
+ *          sorted posting list of the IDs whose name contains it. A substring
+ *          query of at least three bytes can only match names that contain
+ *          every trigram of the query, so intersecting those posting lists
+ *          yields a small candidate set that callers verify against the real
+ *          name. Candidates are returned in ascending ID order.
+ *
+ *          Queries shorter than three bytes have no trigram to look up; the
+ *          index reports that so callers fall back to a scan.
+ */
+class TrigramIndex {
+private:
+    /// Folded trigram packed into the low 24 bits -> sorted student IDs
+    std::unordered_map<uint32_t, std::vector<uint32_t>> postings;
+
+    static std::vector<uint32_t> trigramsOf(std::string_view folded);
+
+public:
+    static constexpr std::size_t GRAM_SIZE = 3;
+
+    /**
+     * @brief Fold a string to lower case the way searches compare names
+     * @param text String to fold
+     * @return Lower-case copy of text (ASCII folding, other bytes unchanged)
+     */
+    static std::string fold(std::string_view text);
+
+    /**
+     * @brief Index a name
+     * @param studentId ID of the student
+     * @param name Name as stored in the Student
+     * @details Adding IDs in ascending order appends to the posting lists
+     */
+    void add(uint32_t studentId, std::string_view name);
+
+    /**
+     * @brief Remove a previously indexed name
+     * @param studentId ID of the student
+     * @param name Name the student was indexed with
+     */
+    void remove(uint32_t studentId, std::string_view name);
+
+    /**
+     * @brief Drop every posting list
+     */
+    void clear();
+
+    /**
+     * @brief Check whether a query can be answered from the index
+     * @param foldedQuery Query already passed through fold()
+     * @return true if the query has at least GRAM_SIZE bytes
+     */
+    static bool canNarrow(std::string_view foldedQuery);
+
+    /**
+     * @brief Get the IDs whose names may contain a query
+     * @param foldedQuery Query already passed through fold(), canNarrow() must be true
+     * @return Ascending IDs whose names contain every trigram of the query
+     * @details The result is a superset of the real matches; callers must
+     *          verify each candidate.
+     */
+    std::vector<uint32_t> candidates(std::string_view foldedQuery) const;
+
+    /**
+     * @brief Get the number of distinct trigrams in the index
+     * @return Number of posting lists
+     */
+    std::size_t getTrigramCount() const;
+};
+
+#endif // TRIGRAM_INDEX_H__
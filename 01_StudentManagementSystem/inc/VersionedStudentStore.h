@@ -0,0 +1,174 @@
+#ifndef VERSIONED_STUDENT_STORE_H__
+#define VERSIONED_STUDENT_STORE_H__
+
+#include "Student.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @file VersionedStudentStore.h
+ * @brief Copy-on-write student tree handing out point-in-time snapshots
+ *
+ * @details The students live in a radix tree keyed by ID with 64 entries
+ *          per node; leaves hold shared_ptrs to immutable Student copies.
+ *          A snapshot shares the root of the current tree. When the owner
+ *          changes a student afterwards, every node on the path to it that a
+ *          snapshot can still reach is copied first (path copying), so the
+ *          snapshot keeps seeing the old tree while the rest of the nodes stay
+ *          shared. Nodes no snapshot refers to are changed in place, which
+ *          keeps mutations cheap when nobody is reading.
+ *
+ *          Old versions are freed by the reference counts: a node or Student
+ *          goes away when the last snapshot that reaches it is destroyed.
+ */
+
+/**
+ * @brief Node of the versioned student tree
+ * @details Inner nodes use children, leaves use students; the other vector
+ *          stays empty
+ */
+struct StudentVersionNode {
+    std::vector<std::shared_ptr<StudentVersionNode>> children;  ///< Subtrees, one per 6-bit digit
+    std::vector<std::shared_ptr<const Student>> students;       ///< Students, one per 6-bit digit
+};
+
+/**
+ * @class StudentSnapshot
+ * @brief Immutable point-in-time view of the students
+ *
+ * @details Cheap to copy and safe to read from any thread without locking.
+ *          Pointers returned by find() stay valid as long as the snapshot.
+ */
+class StudentSnapshot {
+private:
+    std::shared_ptr<const StudentVersionNode> root;  ///< Tree root, nullptr if empty
+    unsigned height;                                 ///< Inner levels above the leaves
+    std::size_t count;                               ///< Number of students
+
+    template <typename Visitor>
+    static void visitNode(const StudentVersionNode& node, unsigned level, Visitor& visit) {
+        if (level == 0) {
+            for (const auto& student : node.students) {
+                if (student) {
+                    visit(*student);
+                }
+            }
+            return;
+        }
+        for (const auto& child : node.children) {
+            if (child) {
+                visitNode(*child, level - 1, visit);
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief Default constructor
+     * @details Creates an empty snapshot
+     */
+    StudentSnapshot();
+
+    /**
+     * @brief Constructor
+     * @param root Root of the tree to share
+     * @param height Inner levels above the leaves
+     * @param count Number of students in the tree
+     */
+    StudentSnapshot(std::shared_ptr<const StudentVersionNode> root, unsigned height, std::size_t count);
+
+    /**
+     * @brief Find a student
+     * @param studentId ID to look for
+     * @return Pointer to the Student, nullptr if the snapshot has none
+     */
+    const Student* find(uint32_t studentId) const;
+
+    /**
+     * @brief Get the number of students
+     * @return Student count
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Check whether the snapshot has no students
+     * @return true if it is empty
+     */
+    bool empty() const;
+
+    /**
+     * @brief Visit every student in ascending ID order
+     * @param visit Callable taking a const Student&
+     */
+    template <typename Visitor>
+    void forEach(Visitor&& visit) const {
+        if (root) {
+            visitNode(*root, height, visit);
+        }
+    }
+};
+
+/**
+ * @class VersionedStudentStore
+ * @brief Single-writer owner of the versioned student tree
+ *
+ * @details Not synchronized itself: mutations and snapshot() must not run
+ *          concurrently (StudentManager calls them under its lock). The
+ *          snapshots it returns can be read and released by any thread at
+ *          any time.
+ */
+class VersionedStudentStore {
+private:
+    std::shared_ptr<StudentVersionNode> root;  ///< Current tree, nullptr if empty
+    unsigned height;                           ///< Inner levels above the leaves
+    std::size_t count;                         ///< Number of students
+
+    StudentVersionNode* leafFor(uint32_t studentId);
+
+public:
+    /// Bits of the ID consumed per tree level
+    static constexpr unsigned BITS = 6;
+    /// Entries per node
+    static constexpr unsigned FANOUT = 1u << BITS;
+
+    /**
+     * @brief Default constructor
+     * @details Creates an empty store
+     */
+    VersionedStudentStore();
+
+    /**
+     * @brief Store a copy of a student, replacing any older version
+     * @param student Student to copy
+     */
+    void upsert(const Student& student);
+
+    /**
+     * @brief Remove a student
+     * @param studentId ID of the student to remove
+     * @return true if a student was removed, false if there was none
+     */
+    bool erase(uint32_t studentId);
+
+    /**
+     * @brief Remove every student
+     * @details Existing snapshots keep their students
+     */
+    void clear();
+
+    /**
+     * @brief Get the number of students
+     * @return Student count
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Take a snapshot of the current students
+     * @return View sharing the current tree, O(1)
+     */
+    StudentSnapshot snapshot() const;
+};
+
+#endif // VERSIONED_STUDENT_STORE_H__
@@ -1,11 +1,15 @@
 #include "Student.h"
 #include "StudentManager.h"
 #include "FileManager.h"
+#include "BackgroundSaver.h"
 #include "CRUD.h"
 #include "DataHandler.h"
+#include "Journal.h"
+#include "Tracing.h"
 #include <iostream>
 #include <limits>
 #include <string>
+#include <thread>
 
 #ifndef FILE_PATH
 #define FILE_PATH ""
@@ -22,6 +26,9 @@ void displayMenu() {
     std::cout << "7. Remove Student from Course\n";
     std::cout << "8. Save Data\n";
     std::cout << "9. Exit\n";
+    std::cout << "10. Show Operation Statistics\n";
+    std::cout << "11. Start/Stop Tracing\n";
+    std::cout << "12. Export Data File in Background\n";
     std::cout << "Enter your choice: ";
 }
 
@@ -30,14 +37,26 @@ int main() {
         std::cerr << "FILE_PATH is not defined" << std::endl;
         exit(-1);
     }
-    // Initialize file manager with data file path
-    FileManager fileManager(FILE_PATH);
+    // Initialize file manager with data file path, parsing large files on all cores
+    FileManager fileManager(FILE_PATH, std::thread::hardware_concurrency());
     
     // Initialize student manager
     StudentManager studentManager;
     
-    // Load existing data
-    loadData(studentManager, fileManager);
+    // Every change is appended to a journal next to the data file
+    Journal journal(std::string(FILE_PATH) + ".journal");
+    // Changes become durable within a second without an fsync per operation
+    DurabilityPolicy durability;
+    durability.mode = DurabilityPolicy::Mode::Interval;
+    durability.intervalMs = 1000;
+    journal.setDurabilityPolicy(durability);
+    
+    // Load existing data and replay changes made since the last checkpoint
+    loadData(studentManager, fileManager, journal);
+    
+    // Keep copy-on-write versions so exports write a snapshot while editing continues
+    studentManager.setSnapshotsEnabled(true);
+    BackgroundSaver saver(studentManager, fileManager);
     
     int choice;
     bool running = true;
@@ -87,14 +106,35 @@ int main() {
                 removeStudentFromCourse(studentManager);
                 break;
             case 8:
-                saveData(studentManager, fileManager);
+                saveData(studentManager, fileManager, journal);
                 break;
             case 9:
                 std::cout << "Saving data before exit...\n";
-                saveData(studentManager, fileManager);
+                // Let a running export finish so the roster is not written twice at once
+                saver.waitIdle();
+                checkpointData(studentManager, fileManager, journal);
                 std::cout << "Exiting program. Goodbye!\n";
                 running = false;
                 break;
+            case 10:
+                std::cout << "\n----- Operation Statistics -----\n";
+                std::cout << StudentManager::getStats().toText();
+                break;
+            case 11:
+                if (Tracer::isEnabled()) {
+                    std::cout << (Tracer::stop() ? "Trace written.\n" : "Failed to write trace.\n");
+                } else {
+                    std::string tracePath;
+                    std::cout << "Enter trace file path: ";
+                    std::cin.ignore();
+                    std::getline(std::cin, tracePath);
+                    Tracer::start(tracePath);
+                    std::cout << "Tracing started; choose 11 again to write the trace.\n";
+                }
+                break;
+            case 12:
+                saveDataInBackground(saver);
+                break;
             default:
                 std::cout << "Invalid choice. Please try again.\n";
         }
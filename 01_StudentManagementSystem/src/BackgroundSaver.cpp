@@ -0,0 +1,118 @@
+#include "BackgroundSaver.h"
+#include <exception>
+#include <utility>
+
+/**
+ * @brief Constructor
+ * @param manager Manager whose students are saved; must outlive the saver
+ * @param fileManager File manager writing the data file; must outlive the saver
+ */
+BackgroundSaver::BackgroundSaver(const StudentManager& manager, FileManager& fileManager)
+    : manager(manager),
+      fileManager(fileManager),
+      queued(false),
+      running(false),
+      completedSaves(0),
+      stopWorker(false) {
+    worker = std::thread(&BackgroundSaver::workerLoop, this);
+}
+
+/**
+ * @brief Destructor
+ * @details Finishes the running and the waiting save, then stops the worker
+ */
+BackgroundSaver::~BackgroundSaver() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopWorker = true;
+    }
+    wakeup.notify_one();
+    worker.join();
+}
+
+/**
+ * @brief Ask for the current students to be saved
+ * @return Future that becomes true once a save containing every change made
+ *         before this call is on disk, false if that save failed
+ * @details Only the snapshot is taken on the calling thread. It is taken
+ *          under the lock, so concurrent requests queue their snapshots in
+ *          the order they were taken and the waiting save ends up with the
+ *          newest one.
+ */
+std::shared_future<bool> BackgroundSaver::requestSave() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!queued) {
+        queuedPromise = std::promise<bool>();
+        queuedFuture = queuedPromise.get_future().share();
+        queued = true;
+    }
+    queuedView = manager.snapshot();
+    wakeup.notify_one();
+    return queuedFuture;
+}
+
+/**
+ * @brief Check whether a save is running or waiting
+ * @return true if the worker has work
+ */
+bool BackgroundSaver::isSaving() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return queued || running;
+}
+
+/**
+ * @brief Wait until no save is running or waiting
+ */
+void BackgroundSaver::waitIdle() const {
+    std::unique_lock<std::mutex> lock(mutex);
+    idle.wait(lock, [this] { return !queued && !running; });
+}
+
+/**
+ * @brief Get the number of saves the worker finished
+ * @return Finished saves
+ */
+uint64_t BackgroundSaver::getCompletedSaveCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return completedSaves;
+}
+
+/**
+ * @brief Worker thread: write waiting saves until asked to stop
+ * @details A stop request is only honoured once nothing is waiting. An
+ *          exception thrown by a save is handed to its future.
+ */
+void BackgroundSaver::workerLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        wakeup.wait(lock, [this] { return queued || stopWorker; });
+        if (!queued) {
+            return;
+        }
+
+        StudentSnapshot view = std::move(queuedView);
+        queuedView = StudentSnapshot();
+        std::promise<bool> promise = std::move(queuedPromise);
+        queued = false;
+        running = true;
+
+        lock.unlock();
+        try {
+            bool saved = fileManager.saveStudents(view);
+            // Drop the snapshot now so its old versions are freed
+            view = StudentSnapshot();
+            promise.set_value(saved);
+        } catch (...) {
+            // An exception escaping the worker would terminate the program
+            view = StudentSnapshot();
+            promise.set_exception(std::current_exception());
+        }
+        lock.lock();
+
+        running = false;
+        completedSaves++;
+        if (!queued) {
+            idle.notify_all();
+        }
+    }
+}
@@ -65,7 +65,7 @@ void searchStudentById(StudentManager& manager) {
     Student* student = manager.getStudent(studentId);
     if (student) {
         std::cout << "\nStudent found:\n";
-        std::cout << student->toString() << std::endl;
+        std::cout << *student << std::endl;
     } else {
         std::cout << "Student not found.\n";
     }
@@ -91,7 +91,7 @@ void searchStudentsByName(StudentManager& manager) {
     } else {
         std::cout << "\nFound " << students.size() << " student(s):\n";
         for (const auto& student : students) {
-            std::cout << "\n" << student->toString() << std::endl;
+            std::cout << "\n" << *student << std::endl;
         }
     }
 }
@@ -100,19 +100,21 @@ void searchStudentsByName(StudentManager& manager) {
  * @brief Display all students in the system
  * @param manager Reference to the StudentManager instance
  * @details Lists all students currently in the system with their
- *          complete information
+ *          complete information. Students are written straight from the
+ *          manager, without copying them or building strings.
  */
 void listAllStudents(StudentManager& manager) {
     std::cout << "\n----- All Students -----\n";
     
-    std::vector<Student> students = manager.getAllStudents();
-    if (students.empty()) {
+    uint32_t count = manager.getStudentCount();
+    if (count == 0) {
         std::cout << "No students in the system.\n";
     } else {
-        std::cout << "Total students: " << students.size() << std::endl;
-        for (const auto& student : students) {
-            std::cout << "\n" << student.toString() << std::endl;
-        }
+        std::cout << "Total students: " << count << std::endl;
+        manager.forEachStudent([](const Student& student) {
+            std::cout << "\n" << student << '\n';
+        });
+        std::cout << std::flush;
     }
 }
 
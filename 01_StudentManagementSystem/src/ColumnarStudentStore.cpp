@@ -0,0 +1,293 @@
+#include "ColumnarStudentStore.h"
+#include <algorithm>
+
+/**
+ * @brief Default constructor
+ * @details Creates an empty store
+ */
+ColumnarStudentStore::ColumnarStudentStore() : deadRows(0), deadCourseRefs(0), sortedById(true) {}
+
+/**
+ * @brief Append a student's course list and point a row at it
+ * @param row Row to update
+ * @param student Student whose courses are stored
+ */
+void ColumnarStudentStore::appendCourses(uint32_t row, const Student& student) {
+    const std::vector<uint32_t>& courseIds = student.getCourseIds();
+    courseOffsets[row] = courseRefs.size();
+    courseRefs.insert(courseRefs.end(), courseIds.begin(), courseIds.end());
+    courseCounts[row] = static_cast<uint32_t>(courseIds.size());
+}
+
+/**
+ * @brief Add a student or replace the row of a student with the same ID
+ * @param student Student to copy into the columns
+ * @details A replaced row is marked dead and the new one appended
+ */
+void ColumnarStudentStore::upsert(const Student& student) {
+    uint32_t studentId = static_cast<uint32_t>(student.getStudentId());
+    erase(studentId);
+
+    uint32_t row = static_cast<uint32_t>(ids.size());
+    if (!ids.empty() && studentId < ids.back()) {
+        sortedById = false;
+    }
+    const std::string& name = student.getName();
+    const std::string& email = student.getEmail();
+
+    ids.push_back(studentId);
+    ages.push_back(student.getAge());
+    live.push_back(1);
+    nameOffsets.push_back(strings.size());
+    nameLengths.push_back(static_cast<uint32_t>(name.size()));
+    strings += name;
+    emailOffsets.push_back(strings.size());
+    emailLengths.push_back(static_cast<uint32_t>(email.size()));
+    strings += email;
+    courseOffsets.push_back(0);
+    courseCounts.push_back(0);
+    appendCourses(row, student);
+
+    rowOf[studentId] = row;
+}
+
+/**
+ * @brief Refresh the course list of a student
+ * @param student Student whose courses changed
+ */
+void ColumnarStudentStore::updateCourses(const Student& student) {
+    auto it = rowOf.find(static_cast<uint32_t>(student.getStudentId()));
+    if (it == rowOf.end()) {
+        return;
+    }
+    deadCourseRefs += courseCounts[it->second];
+    appendCourses(it->second, student);
+    compactIfNeeded();
+}
+
+/**
+ * @brief Remove a student
+ * @param studentId ID of the student to remove
+ * @return true if a row was removed, false if the ID is unknown
+ */
+bool ColumnarStudentStore::erase(uint32_t studentId) {
+    auto it = rowOf.find(studentId);
+    if (it == rowOf.end()) {
+        return false;
+    }
+    live[it->second] = 0;
+    ++deadRows;
+    deadCourseRefs += courseCounts[it->second];
+    rowOf.erase(it);
+    compactIfNeeded();
+    return true;
+}
+
+/**
+ * @brief Remove every row
+ */
+void ColumnarStudentStore::clear() {
+    *this = ColumnarStudentStore();
+}
+
+/**
+ * @brief Reserve room for a number of rows
+ * @param rows Expected row count
+ */
+void ColumnarStudentStore::reserve(std::size_t rows) {
+    ids.reserve(rows);
+    ages.reserve(rows);
+    live.reserve(rows);
+    nameOffsets.reserve(rows);
+    nameLengths.reserve(rows);
+    emailOffsets.reserve(rows);
+    emailLengths.reserve(rows);
+    courseOffsets.reserve(rows);
+    courseCounts.reserve(rows);
+    rowOf.reserve(rows);
+}
+
+/**
+ * @brief Rebuild the columns without dead rows once they dominate
+ * @details Live rows are copied in ID order, so the rebuilt store is sorted
+ *          again and its arenas only hold live data
+ */
+void ColumnarStudentStore::compactIfNeeded() {
+    bool manyDeadRows = deadRows > 1024 && deadRows > ids.size() / 2;
+    bool manyDeadRefs = deadCourseRefs > 1024 && deadCourseRefs > courseRefs.size() / 2;
+    if (!manyDeadRows && !manyDeadRefs) {
+        return;
+    }
+
+    std::vector<uint32_t> order;
+    order.reserve(rowOf.size());
+    for (uint32_t row = 0; row < ids.size(); ++row) {
+        if (live[row]) {
+            order.push_back(row);
+        }
+    }
+    std::sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b) { return ids[a] < ids[b]; });
+
+    ColumnarStudentStore compacted;
+    compacted.reserve(order.size());
+    for (uint32_t row : order) {
+        uint32_t newRow = static_cast<uint32_t>(compacted.ids.size());
+        compacted.ids.push_back(ids[row]);
+        compacted.ages.push_back(ages[row]);
+        compacted.live.push_back(1);
+        compacted.nameOffsets.push_back(compacted.strings.size());
+        compacted.nameLengths.push_back(nameLengths[row]);
+        compacted.strings.append(strings, nameOffsets[row], nameLengths[row]);
+        compacted.emailOffsets.push_back(compacted.strings.size());
+        compacted.emailLengths.push_back(emailLengths[row]);
+        compacted.strings.append(strings, emailOffsets[row], emailLengths[row]);
+        compacted.courseOffsets.push_back(compacted.courseRefs.size());
+        compacted.courseCounts.push_back(courseCounts[row]);
+        compacted.courseRefs.insert(compacted.courseRefs.end(),
+                                    courseRefs.begin() + courseOffsets[row],
+                                    courseRefs.begin() + courseOffsets[row] + courseCounts[row]);
+        compacted.rowOf[ids[row]] = newRow;
+    }
+    *this = std::move(compacted);
+}
+
+/**
+ * @brief Bring filter results into ID order if the rows are not sorted
+ * @param result IDs to sort
+ */
+void ColumnarStudentStore::sortIds(std::vector<uint32_t>& result) const {
+    if (!sortedById) {
+        std::sort(result.begin(), result.end());
+    }
+}
+
+/**
+ * @brief Get the number of live students
+ * @return Student count
+ */
+std::size_t ColumnarStudentStore::size() const {
+    return rowOf.size();
+}
+
+/**
+ * @brief Find the students whose age lies in a range
+ * @param minAge Smallest age to include
+ * @param maxAge Largest age to include
+ * @return Matching IDs in ascending order
+ * @details Branch-free: every ID is written to the output and the cursor
+ *          only advances on a match, so the loop has no data-dependent jumps
+ */
+std::vector<uint32_t> ColumnarStudentStore::filterByAgeRange(int minAge, int maxAge) const {
+    std::vector<uint32_t> result;
+    if (minAge > maxAge) {
+        return result;
+    }
+    // age - minAge <= span as unsigned covers both bounds in one comparison
+    const uint32_t low = static_cast<uint32_t>(minAge);
+    const uint32_t span = static_cast<uint32_t>(maxAge) - low;
+    const std::size_t rows = ids.size();
+    const int32_t* age = ages.data();
+    const uint8_t* alive = live.data();
+    const uint32_t* id = ids.data();
+
+    result.resize(rows);
+    uint32_t* out = result.data();
+    std::size_t matches = 0;
+    for (std::size_t i = 0; i < rows; ++i) {
+        out[matches] = id[i];
+        matches += (static_cast<uint32_t>(age[i]) - low <= span) & alive[i];
+    }
+    result.resize(matches);
+    sortIds(result);
+    return result;
+}
+
+/**
+ * @brief Count the students whose age lies in a range
+ * @param minAge Smallest age to include
+ * @param maxAge Largest age to include
+ * @return Number of matching students
+ * @details A pure reduction over two columns, which compilers vectorize
+ */
+std::size_t ColumnarStudentStore::countByAgeRange(int minAge, int maxAge) const {
+    if (minAge > maxAge) {
+        return 0;
+    }
+    const uint32_t low = static_cast<uint32_t>(minAge);
+    const uint32_t span = static_cast<uint32_t>(maxAge) - low;
+    const std::size_t rows = ids.size();
+    const int32_t* age = ages.data();
+    const uint8_t* alive = live.data();
+
+    uint32_t matches = 0;
+    for (std::size_t i = 0; i < rows; ++i) {
+        matches += (static_cast<uint32_t>(age[i]) - low <= span) & alive[i];
+    }
+    return matches;
+}
+
+/**
+ * @brief Find the students whose ID lies in a range
+ * @param firstId Smallest ID to include
+ * @param lastId Largest ID to include
+ * @return Matching IDs in ascending order
+ * @details When the rows are sorted by ID only the matching slice is read
+ */
+std::vector<uint32_t> ColumnarStudentStore::filterByIdRange(uint32_t firstId, uint32_t lastId) const {
+    std::vector<uint32_t> result;
+    if (firstId > lastId) {
+        return result;
+    }
+    std::size_t begin = 0;
+    std::size_t end = ids.size();
+    if (sortedById) {
+        begin = static_cast<std::size_t>(std::lower_bound(ids.begin(), ids.end(), firstId) - ids.begin());
+        end = static_cast<std::size_t>(std::upper_bound(ids.begin(), ids.end(), lastId) - ids.begin());
+    }
+    const uint32_t span = lastId - firstId;
+    const uint8_t* alive = live.data();
+    const uint32_t* id = ids.data();
+
+    result.resize(end - begin);
+    uint32_t* out = result.data();
+    std::size_t matches = 0;
+    for (std::size_t i = begin; i < end; ++i) {
+        out[matches] = id[i];
+        matches += (id[i] - firstId <= span) & alive[i];
+    }
+    result.resize(matches);
+    sortIds(result);
+    return result;
+}
+
+/**
+ * @brief Get the name of a student
+ * @param studentId ID of the student
+ * @return Name bytes inside the arena, empty if the ID is unknown
+ */
+std::string_view ColumnarStudentStore::getName(uint32_t studentId) const {
+    auto it = rowOf.find(studentId);
+    if (it == rowOf.end()) {
+        return std::string_view();
+    }
+    return std::string_view(strings).substr(nameOffsets[it->second], nameLengths[it->second]);
+}
+
+/**
+ * @brief Rebuild a Student from its row
+ * @param studentId ID of the student
+ * @return The Student, or std::nullopt if the ID is unknown
+ */
+std::optional<Student> ColumnarStudentStore::materialize(uint32_t studentId) const {
+    auto it = rowOf.find(studentId);
+    if (it == rowOf.end()) {
+        return std::nullopt;
+    }
+    uint32_t row = it->second;
+    Student student(static_cast<int>(studentId), strings.substr(nameOffsets[row], nameLengths[row]),
+                    strings.substr(emailOffsets[row], emailLengths[row]), ages[row]);
+    for (uint32_t i = 0; i < courseCounts[row]; ++i) {
+        student.addCourseId(courseRefs[courseOffsets[row] + i]);
+    }
+    return student;
+}
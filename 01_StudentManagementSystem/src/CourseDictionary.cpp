@@ -0,0 +1,75 @@
+#include "CourseDictionary.h"
+#include <mutex>
+
+/**
+ * @brief Get the table shared by every Student
+ * @return The process-wide dictionary
+ */
+CourseDictionary& CourseDictionary::instance() {
+    static CourseDictionary dictionary;
+    return dictionary;
+}
+
+/**
+ * @brief Get the ID of a course, adding the name if it is new
+ * @param course Course name
+ * @return Course ID
+ * @details Known names only take the shared lock. A new name is looked up
+ *          again under the exclusive lock, since another thread may have
+ *          added it in between.
+ */
+uint32_t CourseDictionary::intern(std::string_view course) {
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        auto it = ids.find(course);
+        if (it != ids.end()) {
+            return it->second;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    auto it = ids.find(course);
+    if (it != ids.end()) {
+        return it->second;
+    }
+    uint32_t courseId = static_cast<uint32_t>(names.size());
+    names.emplace_back(course);
+    ids.emplace(names.back(), courseId);
+    return courseId;
+}
+
+/**
+ * @brief Look up the ID of a course without adding it
+ * @param course Course name
+ * @return Course ID, or std::nullopt if no student was ever enrolled in it
+ */
+std::optional<uint32_t> CourseDictionary::find(std::string_view course) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    auto it = ids.find(course);
+    if (it == ids.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+/**
+ * @brief Get the name of a course
+ * @param courseId Course ID returned by intern()
+ * @return Course name; an empty string for unknown IDs
+ * @details The reference stays valid after the lock is released because
+ *          deque elements never move
+ */
+const std::string& CourseDictionary::name(uint32_t courseId) const {
+    static const std::string unknown;
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return courseId < names.size() ? names[courseId] : unknown;
+}
+
+/**
+ * @brief Get the number of distinct course names
+ * @return Course count
+ */
+std::size_t CourseDictionary::size() const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return names.size();
+}
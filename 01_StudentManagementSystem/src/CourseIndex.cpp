@@ -0,0 +1,115 @@
+#include "CourseIndex.h"
+#include <algorithm>
+
+/**
+ * @brief Record that a student is enrolled in a course
+ * @param courseId CourseDictionary ID of the course
+ * @param studentId ID of the student
+ * @details Adding an existing pair does nothing
+ */
+void CourseIndex::add(uint32_t courseId, uint32_t studentId) {
+    if (courseId >= postings.size()) {
+        postings.resize(courseId + 1);
+    }
+    postings[courseId].add(studentId);
+}
+
+/**
+ * @brief Record that a student left a course
+ * @param courseId CourseDictionary ID of the course
+ * @param studentId ID of the student
+ */
+void CourseIndex::remove(uint32_t courseId, uint32_t studentId) {
+    if (courseId < postings.size()) {
+        postings[courseId].remove(studentId);
+    }
+}
+
+/**
+ * @brief Record every enrollment of a student
+ * @param studentId ID of the student
+ * @param courseIds CourseDictionary IDs the student is enrolled in
+ */
+void CourseIndex::addStudent(uint32_t studentId, const std::vector<uint32_t>& courseIds) {
+    for (uint32_t courseId : courseIds) {
+        add(courseId, studentId);
+    }
+}
+
+/**
+ * @brief Forget every enrollment of a student
+ * @param studentId ID of the student
+ * @param courseIds CourseDictionary IDs the student was indexed with
+ */
+void CourseIndex::removeStudent(uint32_t studentId, const std::vector<uint32_t>& courseIds) {
+    for (uint32_t courseId : courseIds) {
+        remove(courseId, studentId);
+    }
+}
+
+/**
+ * @brief Drop every course's student set
+ */
+void CourseIndex::clear() {
+    postings.clear();
+}
+
+/**
+ * @brief Get the students enrolled in a course
+ * @param courseId CourseDictionary ID of the course
+ * @return Set of student IDs; empty for courses without students
+ */
+const RoaringBitmap& CourseIndex::students(uint32_t courseId) const {
+    static const RoaringBitmap none;
+    return courseId < postings.size() ? postings[courseId] : none;
+}
+
+/**
+ * @brief Get the number of students enrolled in a course
+ * @param courseId CourseDictionary ID of the course
+ * @return Enrollment count
+ */
+std::size_t CourseIndex::count(uint32_t courseId) const {
+    return static_cast<std::size_t>(students(courseId).cardinality());
+}
+
+/**
+ * @brief Get the students enrolled in every one of some courses
+ * @param courseIds CourseDictionary IDs; must not be empty
+ * @return Intersection of the courses' student sets
+ * @details Starts from the smallest set, so every later intersection works
+ *          on at most that many students, and stops once the result is empty
+ */
+RoaringBitmap CourseIndex::matchAll(const std::vector<uint32_t>& courseIds) const {
+    std::vector<const RoaringBitmap*> sets;
+    sets.reserve(courseIds.size());
+    for (uint32_t courseId : courseIds) {
+        sets.push_back(&students(courseId));
+    }
+    std::sort(sets.begin(), sets.end(), [](const RoaringBitmap* a, const RoaringBitmap* b) {
+        return a->cardinality() < b->cardinality();
+    });
+
+    RoaringBitmap result;
+    if (sets.empty()) {
+        return result;
+    }
+    result = *sets.front();
+    for (std::size_t i = 1; i < sets.size() && !result.empty(); ++i) {
+        result &= *sets[i];
+    }
+    return result;
+}
+
+/**
+ * @brief Get the students enrolled in at least one of some courses
+ * @param courseIds CourseDictionary IDs
+ * @return Union of the courses' student sets
+ */
+RoaringBitmap CourseIndex::matchAny(const std::vector<uint32_t>& courseIds) const {
+    RoaringBitmap result;
+    for (uint32_t courseId : courseIds) {
+        result |= students(courseId);
+    }
+    return result;
+}
@@ -0,0 +1,309 @@
+#include "CsvParser.h"
+#include "Tracing.h"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+/**
+ * @brief Convert a numeric field to int the way std::stoi does
+ * @param field Text of the field
+ * @return The parsed value
+ * @details Leading whitespace and a leading '+' are accepted and trailing
+ *          characters after the digits are ignored
+ */
+int parseInt(std::string_view field) {
+    std::size_t pos = 0;
+    while (pos < field.size() &&
+           (field[pos] == ' ' || (field[pos] >= '\t' && field[pos] <= '\r'))) {
+        ++pos;
+    }
+    if (pos + 1 < field.size() && field[pos] == '+' && field[pos + 1] != '-') {
+        ++pos;
+    }
+
+    int value = 0;
+    auto result = std::from_chars(field.data() + pos, field.data() + field.size(), value);
+    if (result.ec == std::errc::invalid_argument) {
+        throw std::invalid_argument("CsvParser: invalid numeric field");
+    }
+    if (result.ec == std::errc::result_out_of_range) {
+        throw std::out_of_range("CsvParser: numeric field out of range");
+    }
+    return value;
+}
+
+/**
+ * @brief Split the next comma separated field off the front of a record
+ * @param rest Remaining part of the record, advanced past the field
+ * @param field Receives the field
+ * @param more Cleared once the last field of the record has been returned
+ * @return false if no field was left
+ */
+bool nextField(std::string_view& rest, std::string_view& field, bool& more) {
+    if (!more) {
+        return false;
+    }
+    std::size_t comma = rest.find(',');
+    if (comma == std::string_view::npos) {
+        field = rest;
+        rest = std::string_view();
+        more = false;
+    } else {
+        field = rest.substr(0, comma);
+        rest.remove_prefix(comma + 1);
+    }
+    return true;
+}
+
+} // namespace
+
+/**
+ * @brief Constructor for CsvParser
+ * @param blockSize Number of bytes to read from the file at a time
+ */
+CsvParser::CsvParser(std::size_t blockSize) : blockSize(blockSize > 0 ? blockSize : DEFAULT_BLOCK_SIZE) {}
+
+/**
+ * @brief Parse a whole data file
+ * @param filePath Path to the CSV data file
+ * @param students Vector the parsed Student objects are appended to
+ * @return true if the file could be opened and read, false otherwise
+ */
+bool CsvParser::parseFile(const std::string& filePath, std::vector<Student>& students) const {
+    return parseRange(filePath, 0, std::numeric_limits<std::uint64_t>::max(), students);
+}
+
+/**
+ * @brief Parse the records that start inside a byte range of a data file
+ * @param filePath Path to the CSV data file
+ * @param begin Offset of the first byte of the range, must be the start of a record
+ * @param end Offset one past the last byte of the range
+ * @param students Vector the parsed Student objects are appended to
+ * @return true if the file could be opened and read, false otherwise
+ * @details Fills a block buffer, parses every complete line in it and moves
+ *          the trailing partial line to the front before the next read. The
+ *          buffer grows only when a single line is longer than the block.
+ */
+bool CsvParser::parseRange(const std::string& filePath, std::uint64_t begin, std::uint64_t end,
+                           std::vector<Student>& students) const {
+    std::ifstream inFile(filePath, std::ios::binary);
+    if (!inFile.is_open()) {
+        return false;
+    }
+    if (begin > 0) {
+        inFile.seekg(static_cast<std::streamoff>(begin));
+    }
+
+    std::vector<char> buffer(blockSize);
+    std::size_t carry = 0;
+    std::uint64_t remaining = end - begin;
+
+    while (inFile && remaining > 0) {
+        if (carry == buffer.size()) {
+            buffer.resize(buffer.size() * 2);
+        }
+        std::uint64_t wanted = std::min<std::uint64_t>(buffer.size() - carry, remaining);
+        std::size_t got = 0;
+        {
+            TraceSpan span("readBlock");
+            inFile.read(buffer.data() + carry, static_cast<std::streamsize>(wanted));
+            got = static_cast<std::size_t>(inFile.gcount());
+            span.setArg("bytes", got);
+        }
+        std::size_t filled = carry + got;
+        remaining -= got;
+
+        std::string_view block(buffer.data(), filled);
+        std::size_t lastNewline = block.rfind('\n');
+        if (lastNewline == std::string_view::npos) {
+            carry = filled;
+            continue;
+        }
+
+        {
+            TraceSpan span("parseBlock");
+            size_t before = students.size();
+            parseBuffer(block.substr(0, lastNewline + 1), students);
+            span.setArg("records", students.size() - before);
+        }
+        carry = filled - (lastNewline + 1);
+        std::memmove(buffer.data(), buffer.data() + lastNewline + 1, carry);
+    }
+
+    if (carry > 0) {
+        TraceSpan span("parseBlock");
+        size_t before = students.size();
+        parseBuffer(std::string_view(buffer.data(), carry), students);
+        span.setArg("records", students.size() - before);
+    }
+    return !inFile.bad();
+}
+
+/**
+ * @brief Parse a whole data file on several threads
+ * @param filePath Path to the CSV data file
+ * @param threadCount Number of worker threads (and byte ranges) to use
+ * @param students Vector the parsed Student objects are appended to, in file order
+ * @return true if the file could be opened and read, false otherwise
+ */
+bool CsvParser::parseFileParallel(const std::string& filePath, unsigned threadCount,
+                                  std::vector<Student>& students) const {
+    std::vector<std::uint64_t> bounds;
+    {
+        TraceSpan span("splitRanges");
+        bounds = splitRanges(filePath, threadCount);
+    }
+    if (bounds.empty()) {
+        return false;
+    }
+    size_t rangeCount = bounds.size() - 1;
+    if (rangeCount <= 1) {
+        return parseFile(filePath, students);
+    }
+
+    std::vector<std::vector<Student>> partial(rangeCount);
+    std::vector<std::exception_ptr> errors(rangeCount);
+    std::vector<char> ok(rangeCount, 0);
+    std::vector<std::thread> workers;
+    workers.reserve(rangeCount);
+
+    for (size_t i = 0; i < rangeCount; ++i) {
+        workers.emplace_back([&, i]() {
+            try {
+                TraceSpan span("parseRange");
+                ok[i] = parseRange(filePath, bounds[i], bounds[i + 1], partial[i]);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    for (size_t i = 0; i < rangeCount; ++i) {
+        if (errors[i]) {
+            std::rethrow_exception(errors[i]);
+        }
+        if (!ok[i]) {
+            return false;
+        }
+    }
+
+    TraceSpan span("mergeRanges");
+    size_t total = students.size();
+    for (const auto& part : partial) {
+        total += part.size();
+    }
+    students.reserve(total);
+    for (auto& part : partial) {
+        std::move(part.begin(), part.end(), std::back_inserter(students));
+    }
+    return true;
+}
+
+/**
+ * @brief Split a data file into byte ranges that start at record boundaries
+ * @param filePath Path to the CSV data file
+ * @param parts Requested number of ranges
+ * @return Sorted range boundaries, from 0 to the file size, or an empty vector
+ *         if the file cannot be opened
+ * @details Each ideal split point is moved forward to the byte after the next
+ *          newline, so no record is ever cut in two.
+ */
+std::vector<std::uint64_t> CsvParser::splitRanges(const std::string& filePath, unsigned parts) {
+    std::vector<std::uint64_t> bounds;
+    std::ifstream inFile(filePath, std::ios::binary | std::ios::ate);
+    if (!inFile.is_open()) {
+        return bounds;
+    }
+    std::uint64_t fileSize = static_cast<std::uint64_t>(inFile.tellg());
+
+    bounds.push_back(0);
+    char chunk[4096];
+    for (unsigned i = 1; i < parts; ++i) {
+        std::uint64_t target = fileSize * i / parts;
+        if (target <= bounds.back()) {
+            continue;
+        }
+
+        // Look for the end of the record containing the byte before target
+        inFile.clear();
+        inFile.seekg(static_cast<std::streamoff>(target - 1));
+        std::uint64_t position = target - 1;
+        std::uint64_t boundary = fileSize;
+        while (inFile) {
+            inFile.read(chunk, sizeof(chunk));
+            std::streamsize got = inFile.gcount();
+            const void* newline = std::memchr(chunk, '\n', static_cast<size_t>(got));
+            if (newline) {
+                boundary = position + (static_cast<const char*>(newline) - chunk) + 1;
+                break;
+            }
+            position += static_cast<std::uint64_t>(got);
+        }
+
+        if (boundary >= fileSize) {
+            break;
+        }
+        if (boundary > bounds.back()) {
+            bounds.push_back(boundary);
+        }
+    }
+    bounds.push_back(fileSize);
+    return bounds;
+}
+
+/**
+ * @brief Parse every record contained in a buffer
+ * @param buffer Text holding zero or more newline separated records
+ * @param students Vector the parsed Student objects are appended to
+ */
+void CsvParser::parseBuffer(std::string_view buffer, std::vector<Student>& students) {
+    while (!buffer.empty()) {
+        std::size_t newline = buffer.find('\n');
+        if (newline == std::string_view::npos) {
+            students.push_back(parseLine(buffer));
+            break;
+        }
+        students.push_back(parseLine(buffer.substr(0, newline)));
+        buffer.remove_prefix(newline + 1);
+    }
+}
+
+/**
+ * @brief Parse a single record
+ * @param line One record without its terminating newline
+ * @return The Student described by the record
+ * @details Course fields follow the getline semantics of the previous reader:
+ *          empty courses in the middle of the list are kept, a single trailing
+ *          empty field is dropped and duplicates are ignored by Student::addCourse.
+ */
+Student CsvParser::parseLine(std::string_view line) {
+    std::string_view rest = line;
+    std::string_view idField, nameField, emailField, ageField;
+    bool more = true;
+
+    if (!nextField(rest, idField, more) || !nextField(rest, nameField, more) ||
+        !nextField(rest, emailField, more) || !nextField(rest, ageField, more)) {
+        throw std::invalid_argument("CsvParser: record has missing fields");
+    }
+
+    Student student(parseInt(idField), std::string(nameField), std::string(emailField),
+                    parseInt(ageField));
+
+    std::string_view course;
+    while (!rest.empty() && nextField(rest, course, more)) {
+        student.addCourse(course);
+    }
+
+    return student;
+}
@@ -1,4 +1,5 @@
 #include "DataHandler.h"
+#include "Tracing.h"
 #include <iostream>
 
 /**
@@ -7,33 +8,115 @@
  * @param fileManager Reference to the FileManager instance
  */
 void saveData(StudentManager& manager, FileManager& fileManager) {
+    TraceSpan span("saveData");
     std::cout << "\n----- Saving Data -----\n";
     
-    if (fileManager.saveStudents(manager.getAllStudents())) {
+    if (fileManager.saveStudents(manager)) {
         std::cout << "Data saved successfully!\n";
     } else {
         std::cout << "Failed to save data.\n";
     }
 }
 
+/**
+ * @brief Save student data to a file on a background thread
+ * @param saver BackgroundSaver writing the manager's students
+ * @return Future that becomes the result of the save
+ */
+std::shared_future<bool> saveDataInBackground(BackgroundSaver& saver) {
+    std::cout << "\n----- Exporting Data -----\n";
+    std::shared_future<bool> result = saver.requestSave();
+    std::cout << "Exporting in the background...\n";
+    return result;
+}
+
 /**
  * @brief Load student data from a file
  * @param manager Reference to the StudentManager instance
  * @param fileManager Reference to the FileManager instance
+ * @details Students keep the IDs stored in the file, including their courses
  */
 void loadData(StudentManager& manager, FileManager& fileManager) {
+    TraceSpan span("loadData");
     std::cout << "Loading data...\n";
     
-    std::vector<Student> loadedStudents = fileManager.loadStudents();
-    for (const auto& student : loadedStudents) {
-        // Add each loaded student to the manager
-        manager.addStudent(student.getName(), student.getEmail(), student.getAge());
-        
-        // Add courses
-        for (const auto& course : student.getCourses()) {
-            manager.enrollStudentInCourse(student.getStudentId(), course);
-        }
+    // Hand the parsed students over in one batch, keeping their saved IDs
+    uint32_t loadedCount = manager.bulkLoadStudents(fileManager.loadStudents());
+    
+    std::cout << "Loaded " << loadedCount << " students.\n";
+}
+
+/**
+ * @brief Save student data incrementally through a journal
+ * @param manager Reference to the StudentManager instance
+ * @param fileManager Reference to the FileManager instance
+ * @param journal Reference to the Journal attached to the manager
+ */
+void saveData(StudentManager& manager, FileManager& fileManager, Journal& journal) {
+    TraceSpan span("saveData");
+    std::cout << "\n----- Saving Data -----\n";
+    
+    if (!journal.sync()) {
+        std::cout << "Failed to save data.\n";
+        return;
     }
     
-    std::cout << "Loaded " << loadedStudents.size() << " students.\n";
+    if (journal.getRecordCount() >= CHECKPOINT_RECORD_THRESHOLD) {
+        checkpointData(manager, fileManager, journal);
+    }
+    std::cout << "Data saved successfully!\n";
+}
+
+/**
+ * @brief Load student data and replay the journal on top of it
+ * @param manager Reference to the StudentManager instance
+ * @param fileManager Reference to the FileManager instance
+ * @param journal Reference to the Journal to replay and attach
+ */
+void loadData(StudentManager& manager, FileManager& fileManager, Journal& journal) {
+    TraceSpan span("loadData");
+    if (fileManager.snapshotExists()) {
+        std::cout << "Loading data...\n";
+        uint32_t loadedCount = manager.bulkLoadStudents(fileManager.loadSnapshot());
+        std::cout << "Loaded " << loadedCount << " students.\n";
+    } else {
+        loadData(manager, fileManager);
+    }
+    
+    uint64_t replayed = 0;
+    {
+        TraceSpan replaySpan("replayJournal");
+        replayed = journal.replay(manager);
+        replaySpan.setArg("records", replayed);
+    }
+    if (replayed > 0) {
+        std::cout << "Replayed " << replayed << " journal records.\n";
+    }
+    
+    journal.open();
+    manager.setJournal(&journal);
+}
+
+/**
+ * @brief Compact the journal into a snapshot
+ * @param manager Reference to the StudentManager instance
+ * @param fileManager Reference to the FileManager instance
+ * @param journal Reference to the Journal attached to the manager
+ * @details The snapshot is synced and renamed into place before the journal
+ *          is truncated, so a crash in between only means the journal is
+ *          replayed again. Only the records the snapshot contains are
+ *          dropped; changes made while it is written stay in the journal.
+ */
+void checkpointData(StudentManager& manager, FileManager& fileManager, Journal& journal) {
+    uint64_t covered = 0;
+    StudentSnapshot view = manager.snapshot(covered);
+    if (!journal.sync() || !fileManager.saveSnapshot(view)) {
+        std::cout << "Failed to write checkpoint.\n";
+        return;
+    }
+    if (!journal.reset(covered)) {
+        std::cout << "Checkpoint written, but the journal could not be truncated.\n";
+        return;
+    }
+    std::cout << "Checkpoint written.\n";
 }
@@ -1,14 +1,115 @@
 #include "FileManager.h"
+#include "CsvParser.h"
+#include "FileSync.h"
+#include "MappedFile.h"
+#include "OperationMetrics.h"
+#include "Snapshot.h"
+#include "StringSearch.h"
+#include "StudentManager.h"
+#include "Tracing.h"
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
 #include <fstream>
-#include <sstream>
 #include <iostream>
+#include <stdexcept>
+
+namespace {
+
+/**
+ * @brief Write a CSV file through a temporary file
+ * @param path Final path of the file
+ * @param writeRecords Callable writing the records to the std::ostream it is given
+ * @return true if the file was written and renamed into place
+ * @details The records go to path + ".tmp", which replaces path only once it
+ *          is complete and synced to disk, so neither a concurrent reader nor
+ *          a crash ever sees a partly written file
+ */
+template <typename WriteRecords>
+bool writeCsvFile(const std::string& path, WriteRecords writeRecords) {
+    const std::string tempPath = path + ".tmp";
+    {
+        std::ofstream outFile(tempPath, std::ios::trunc);
+        if (!outFile.is_open()) {
+            std::cerr << "Error: Unable to open file for writing: " << path << std::endl;
+            return false;
+        }
+        {
+            TraceSpan span("writeRecords");
+            writeRecords(outFile);
+        }
+        TraceSpan span("closeFile");
+        outFile.close();
+        if (outFile.fail()) {
+            std::remove(tempPath.c_str());
+            return false;
+        }
+    }
+    
+    TraceSpan span("renameFile");
+    if (!replaceFileDurably(tempPath, path)) {
+        std::cerr << "Error: Unable to replace file: " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+/**
+ * @brief A memory-mapped snapshot and the view over its bytes
+ */
+struct FileManager::MappedSnapshot {
+    MappedFile file;      ///< The mapping
+    SnapshotView view;    ///< Validated view over the mapping
+};
 
 /**
  * @brief Constructor for FileManager
  * @param filePath Path to the data file
+ * @param loadThreads Maximum number of threads used to parse the data file
  * @details Initializes the FileManager with the specified file path for storing student data
  */
-FileManager::FileManager(const std::string& filePath) : dataFilePath(filePath) {}
+FileManager::FileManager(const std::string& filePath, unsigned loadThreads)
+    : dataFilePath(filePath), snapshotFilePath(filePath + ".snap"), loadThreadCount(loadThreads > 0 ? loadThreads : 1) {}
+
+/**
+ * @brief Destructor
+ * @details Unmaps the snapshot if it is mapped
+ */
+FileManager::~FileManager() = default;
+
+/**
+ * @brief Set the maximum number of threads used by loadStudents
+ * @param threads Thread count, 0 or 1 selects the single-threaded reader
+ */
+void FileManager::setLoadThreadCount(unsigned threads) {
+    loadThreadCount = threads > 0 ? threads : 1;
+}
+
+/**
+ * @brief Get the maximum number of threads used by loadStudents
+ * @return Configured thread count
+ */
+unsigned FileManager::getLoadThreadCount() const {
+    return loadThreadCount;
+}
+
+/**
+ * @brief Write one student as a record of the CSV data file
+ * @param out Stream to write to
+ * @param student Student to write
+ * @details ID,Name,Email,Age,Course1,Course2,... followed by '\n'. Every
+ *          field is streamed from the Student as is, nothing is allocated.
+ */
+void FileManager::writeCsvRecord(std::ostream& out, const Student& student) {
+    out << student.getStudentId() << ","
+        << student.getName() << ","
+        << student.getEmail() << ","
+        << student.getAge();
+    student.forEachCourse([&out](const std::string& course) { out << "," << course; });
+    out << '\n';
+}
 
 /**
  * @brief Save student data to file
@@ -16,41 +117,63 @@ FileManager::FileManager(const std::string& filePath) : dataFilePath(filePath) {
  * @return true if save operation was successful, false otherwise
  * @details Saves student data in CSV format with the following structure:
  *          ID,Name,Email,Age,Course1,Course2,...
+ *          Records end in '\n' rather than std::endl so the stream is only
+ *          flushed when its buffer fills. The file is written under a
+ *          temporary name and renamed into place.
  */
 bool FileManager::saveStudents(const std::vector<Student>& students) {
-    std::ofstream outFile(dataFilePath);
-    if (!outFile.is_open()) {
-        std::cerr << "Error: Unable to open file for writing: " << dataFilePath << std::endl;
-        return false;
-    }
-    
-    for (const auto& student : students) {
-        // Write student data in CSV format
-        outFile << student.getStudentId() << ","
-                << student.getName() << ","
-                << student.getEmail() << ","
-                << student.getAge();
-        
-        // Write courses
-        const auto& courses = student.getCourses();
-        for (const auto& course : courses) {
-            outFile << "," << course;
+    SMS_METRICS_SCOPE(Operation::SaveStudents);
+    TraceSpan span("saveStudents");
+    return writeCsvFile(dataFilePath, [&students](std::ostream& out) {
+        for (const auto& student : students) {
+            writeCsvRecord(out, student);
         }
-        
-        outFile << std::endl;
-    }
-    
-    outFile.close();
-    return true;
+    });
+}
+
+/**
+ * @brief Save every student of a manager to file
+ * @param manager Manager whose students are written, in ID order
+ * @return true if save operation was successful, false otherwise
+ * @details Same format as saveStudents(const std::vector<Student>&), but
+ *          the students are streamed straight from the manager instead of
+ *          being copied into a vector first
+ */
+bool FileManager::saveStudents(const StudentManager& manager) {
+    SMS_METRICS_SCOPE(Operation::SaveStudents);
+    TraceSpan span("saveStudents");
+    return writeCsvFile(dataFilePath, [&manager](std::ostream& out) {
+        manager.forEachStudent([&out](const Student& student) { writeCsvRecord(out, student); });
+    });
+}
+
+/**
+ * @brief Save the students of a point-in-time view to file
+ * @param view Snapshot whose students are written, in ID order
+ * @return true if save operation was successful, false otherwise
+ * @details Same format as saveStudents(const std::vector<Student>&). The
+ *          view cannot change, so this can run on any thread while the
+ *          manager it came from keeps changing.
+ */
+bool FileManager::saveStudents(const StudentSnapshot& view) {
+    SMS_METRICS_SCOPE(Operation::SaveStudents);
+    TraceSpan span("saveStudents");
+    return writeCsvFile(dataFilePath, [&view](std::ostream& out) {
+        view.forEach([&out](const Student& student) { writeCsvRecord(out, student); });
+    });
 }
 
 /**
  * @brief Load student data from file
  * @return Vector of Student objects loaded from file
- * @details Reads CSV formatted student data and creates Student objects
+ * @details Reads CSV formatted student data and creates Student objects using
+ *          the block-based CsvParser. Large files are parsed on up to
+ *          loadThreadCount threads.
  *          If file doesn't exist, creates an empty file and returns empty vector
  */
 std::vector<Student> FileManager::loadStudents() {
+    SMS_METRICS_SCOPE(Operation::LoadStudents);
+    TraceSpan span("loadStudents");
     std::vector<Student> students;
     
     if (!fileExists()) {
@@ -59,48 +182,265 @@ std::vector<Student> FileManager::loadStudents() {
         return students;
     }
     
-    std::ifstream inFile(dataFilePath);
-    if (!inFile.is_open()) {
+    // Only split the file when every thread gets a worthwhile amount of data
+    std::error_code error;
+    std::uint64_t fileSize = std::filesystem::file_size(dataFilePath, error);
+    unsigned threads = 1;
+    if (!error && loadThreadCount > 1) {
+        std::uint64_t maxThreads = fileSize / MIN_BYTES_PER_LOAD_THREAD;
+        threads = static_cast<unsigned>(std::max<std::uint64_t>(1, std::min<std::uint64_t>(loadThreadCount, maxThreads)));
+    }
+    
+    CsvParser parser;
+    bool loaded = threads > 1 ? parser.parseFileParallel(dataFilePath, threads, students)
+                              : parser.parseFile(dataFilePath, students);
+    if (!loaded) {
         std::cerr << "Error: Unable to open file for reading: " << dataFilePath << std::endl;
+    }
+    span.setArg("records", students.size());
+    
+    return students;
+}
+
+/**
+ * @brief Save student data to the binary snapshot file
+ * @param students Vector of Student objects to save
+ * @return true if save operation was successful, false otherwise
+ * @details See Snapshot.h for the file layout. The snapshot is written to a
+ *          temporary file and renamed into place.
+ */
+bool FileManager::saveSnapshot(const std::vector<Student>& students) {
+    SMS_METRICS_SCOPE(Operation::SaveSnapshot);
+    if (!writeSnapshot(snapshotFilePath, students)) {
+        std::cerr << "Error: Unable to write snapshot: " << snapshotFilePath << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Save every student of a manager to the binary snapshot file
+ * @param manager Manager whose students are written
+ * @return true if save operation was successful, false otherwise
+ * @details Writes from manager.snapshot(), which keeps every student alive
+ *          while the file is written and mutations continue. That is O(1)
+ *          with snapshots enabled and a copy of the students otherwise;
+ *          pointers into the live store would dangle once its lock is
+ *          released.
+ */
+bool FileManager::saveSnapshot(const StudentManager& manager) {
+    return saveSnapshot(manager.snapshot());
+}
+
+/**
+ * @brief Save the students of a point-in-time view to the binary snapshot file
+ * @param view Snapshot whose students are written
+ * @return true if save operation was successful, false otherwise
+ * @details The view cannot change, so no lock is held while writing
+ */
+bool FileManager::saveSnapshot(const StudentSnapshot& view) {
+    SMS_METRICS_SCOPE(Operation::SaveSnapshot);
+    std::vector<const Student*> students;
+    students.reserve(view.size());
+    view.forEach([&students](const Student& student) { students.push_back(&student); });
+    if (!writeSortedSnapshot(snapshotFilePath, students)) {
+        std::cerr << "Error: Unable to write snapshot: " << snapshotFilePath << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Load student data from the binary snapshot file
+ * @return Vector of Student objects loaded from the snapshot, empty if the
+ *         snapshot is missing or invalid
+ * @details Reads the whole snapshot with a single read and materializes
+ *          every record
+ */
+std::vector<Student> FileManager::loadSnapshot() {
+    SMS_METRICS_SCOPE(Operation::LoadSnapshot);
+    TraceSpan span("loadSnapshot");
+    std::vector<Student> students;
+    
+    std::ifstream inFile(snapshotFilePath, std::ios::binary | std::ios::ate);
+    if (!inFile.is_open()) {
+        std::cerr << "Error: Unable to open snapshot for reading: " << snapshotFilePath << std::endl;
         return students;
     }
     
-    std::string line;
-    while (std::getline(inFile, line)) {
-        std::stringstream ss(line);
-        std::string token;
-        
-        // Parse student ID
-        std::getline(ss, token, ',');
-        int studentId = std::stoi(token);
-        
-        // Parse name
-        std::getline(ss, token, ',');
-        std::string name = token;
-        
-        // Parse email
-        std::getline(ss, token, ',');
-        std::string email = token;
-        
-        // Parse age
-        std::getline(ss, token, ',');
-        int age = std::stoi(token);
-        
-        // Create student object
-        Student student(studentId, name, email, age);
-        
-        // Parse courses
-        while (std::getline(ss, token, ',')) {
-            student.addCourse(token);
+    std::vector<char> buffer(static_cast<size_t>(inFile.tellg()));
+    inFile.seekg(0);
+    inFile.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    
+    SnapshotView view;
+    if (!inFile || !view.attach(buffer.data(), buffer.size())) {
+        std::cerr << "Error: Invalid snapshot file: " << snapshotFilePath << std::endl;
+        return students;
+    }
+    
+    try {
+        students.reserve(view.size());
+        for (size_t i = 0; i < view.size(); ++i) {
+            students.push_back(view.materialize(i));
         }
-        
-        students.push_back(student);
+    } catch (const std::out_of_range&) {
+        std::cerr << "Error: Corrupt snapshot record in: " << snapshotFilePath << std::endl;
+        students.clear();
     }
     
-    inFile.close();
     return students;
 }
 
+/**
+ * @brief Check if the binary snapshot file exists
+ * @return true if the snapshot exists and is accessible, false otherwise
+ */
+bool FileManager::snapshotExists() const {
+    std::ifstream file(snapshotFilePath);
+    return file.good();
+}
+
+/**
+ * @brief Get the path of the binary snapshot file
+ * @return The data file path with ".snap" appended
+ */
+const std::string& FileManager::getSnapshotPath() const {
+    return snapshotFilePath;
+}
+
+/**
+ * @brief Convert the CSV data file into a binary snapshot
+ * @return true if the snapshot was written, false otherwise
+ */
+bool FileManager::convertCsvToSnapshot() {
+    return saveSnapshot(loadStudents());
+}
+
+/**
+ * @brief Convert the binary snapshot back into the CSV data file
+ * @return true if the CSV file was written, false otherwise
+ */
+bool FileManager::convertSnapshotToCsv() {
+    if (!snapshotExists()) {
+        std::cerr << "Error: Snapshot file does not exist: " << snapshotFilePath << std::endl;
+        return false;
+    }
+    return saveStudents(loadSnapshot());
+}
+
+/**
+ * @brief Memory-map the binary snapshot for read-only lookups
+ * @return true if the snapshot was mapped and its header is valid, false otherwise
+ */
+bool FileManager::mapSnapshot() {
+    auto mapped = std::make_unique<MappedSnapshot>();
+    if (!mapped->file.open(snapshotFilePath)) {
+        std::cerr << "Error: Unable to map snapshot: " << snapshotFilePath << std::endl;
+        return false;
+    }
+    if (!mapped->view.attach(mapped->file.data(), mapped->file.size())) {
+        std::cerr << "Error: Invalid snapshot file: " << snapshotFilePath << std::endl;
+        return false;
+    }
+    mappedSnapshot = std::move(mapped);
+    return true;
+}
+
+/**
+ * @brief Release the memory-mapped snapshot
+ */
+void FileManager::unmapSnapshot() {
+    mappedSnapshot.reset();
+}
+
+/**
+ * @brief Check whether the snapshot is memory-mapped
+ * @return true if mapSnapshot succeeded and unmapSnapshot was not called since
+ */
+bool FileManager::isSnapshotMapped() const {
+    return mappedSnapshot != nullptr;
+}
+
+/**
+ * @brief Get the number of students in the mapped snapshot
+ * @return Number of students, 0 when no snapshot is mapped
+ */
+size_t FileManager::getMappedStudentCount() const {
+    return mappedSnapshot ? mappedSnapshot->view.size() : 0;
+}
+
+/**
+ * @brief Retrieve a student from the mapped snapshot
+ * @param studentId The ID of the student to find
+ * @return The Student built from its record, or std::nullopt if not found
+ *         or no snapshot is mapped
+ * @details Binary search over the mapped records; only the found record is
+ *          turned into a Student
+ */
+std::optional<Student> FileManager::getStudent(uint32_t studentId) const {
+    if (!mappedSnapshot) {
+        return std::nullopt;
+    }
+    const SnapshotView& view = mappedSnapshot->view;
+    size_t index = view.find(studentId);
+    if (index == view.size()) {
+        return std::nullopt;
+    }
+    try {
+        return view.materialize(index);
+    } catch (const std::out_of_range&) {
+        return std::nullopt;
+    }
+}
+
+/**
+ * @brief Search the mapped snapshot for students by name
+ * @param name Full or partial name to search for (case-insensitive)
+ * @return IDs of matching students in ID order; no Student is built
+ * @details Names are compared in place in the mapped string table.
+ *          Records with corrupt name references never match.
+ */
+std::vector<uint32_t> FileManager::searchStudentIdsByName(const std::string& name) const {
+    std::vector<uint32_t> result;
+    if (!mappedSnapshot) {
+        return result;
+    }
+    const SnapshotView& view = mappedSnapshot->view;
+    for (size_t i = 0; i < view.size(); ++i) {
+        try {
+            if (containsIgnoreCase(view.name(i), name)) {
+                result.push_back(view.record(i).studentId);
+            }
+        } catch (const std::out_of_range&) {
+            continue;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Search the mapped snapshot for students by name
+ * @param name Full or partial name to search for (case-insensitive)
+ * @return Matching students in ID order; only the matches are built
+ */
+std::vector<Student> FileManager::searchStudentsByName(const std::string& name) const {
+    std::vector<Student> result;
+    if (!mappedSnapshot) {
+        return result;
+    }
+    const SnapshotView& view = mappedSnapshot->view;
+    for (size_t i = 0; i < view.size(); ++i) {
+        try {
+            if (containsIgnoreCase(view.name(i), name)) {
+                result.push_back(view.materialize(i));
+            }
+        } catch (const std::out_of_range&) {
+            continue;
+        }
+    }
+    return result;
+}
+
 /**
  * @brief Check if the data file exists
  * @return true if file exists and is accessible, false otherwise
@@ -0,0 +1,81 @@
+#include "FileSync.h"
+#include <cstdio>
+#include <filesystem>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#else
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+/**
+ * @brief Flush a file's data to stable storage
+ * @param filePath Path of a closed file
+ * @return true if the file was synced, false otherwise
+ */
+bool syncFile(const std::string& filePath) {
+#if !defined(_WIN32)
+    int fd = ::open(filePath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    bool ok = ::fsync(fd) == 0;
+    ::close(fd);
+    return ok;
+#else
+    // _commit needs a descriptor opened for writing
+    int fd = ::_open(filePath.c_str(), _O_RDWR | _O_BINARY);
+    if (fd < 0) {
+        return false;
+    }
+    bool ok = ::_commit(fd) == 0;
+    ::_close(fd);
+    return ok;
+#endif
+}
+
+/**
+ * @brief Flush the directory entry of a file to stable storage
+ * @param filePath Path of a file whose directory is synced
+ * @return true if the directory was synced, false otherwise
+ */
+bool syncParentDirectory(const std::string& filePath) {
+#if !defined(_WIN32)
+    std::filesystem::path directory = std::filesystem::path(filePath).parent_path();
+    if (directory.empty()) {
+        directory = ".";
+    }
+    int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd < 0) {
+        return false;
+    }
+    bool ok = ::fsync(fd) == 0;
+    ::close(fd);
+    return ok;
+#else
+    (void)filePath;
+    return true;
+#endif
+}
+
+/**
+ * @brief Durably replace a file with a completely written temporary file
+ * @param tempPath Closed temporary file holding the new contents
+ * @param filePath File to replace
+ * @return true if the new contents are in place and on stable storage
+ */
+bool replaceFileDurably(const std::string& tempPath, const std::string& filePath) {
+    if (!syncFile(tempPath)) {
+        std::remove(tempPath.c_str());
+        return false;
+    }
+    std::error_code error;
+    std::filesystem::rename(tempPath, filePath, error);
+    if (error) {
+        std::remove(tempPath.c_str());
+        return false;
+    }
+    return syncParentDirectory(filePath);
+}
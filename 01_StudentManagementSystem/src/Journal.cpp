@@ -0,0 +1,674 @@
+#include "Journal.h"
+#include "CourseDictionary.h"
+#include "FileSync.h"
+#include "StudentManager.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#else
+#include <io.h>
+#endif
+
+namespace {
+
+constexpr char JOURNAL_MAGIC[8] = {'S', 'M', 'S', 'J', 'R', 'N', 'L', '1'};
+constexpr size_t RECORD_HEADER_SIZE = 2 * sizeof(uint32_t) + 1;
+
+void putU32(std::string& out, uint32_t value) {
+    char bytes[sizeof(value)];
+    std::memcpy(bytes, &value, sizeof(value));
+    out.append(bytes, sizeof(bytes));
+}
+
+void putString(std::string& out, const std::string& value) {
+    putU32(out, static_cast<uint32_t>(value.size()));
+    out += value;
+}
+
+/**
+ * @brief FNV-1a checksum over a record's type and payload
+ */
+uint32_t checksum(uint8_t type, const char* payload, size_t size) {
+    uint32_t hash = 2166136261u;
+    hash = (hash ^ type) * 16777619u;
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ static_cast<unsigned char>(payload[i])) * 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief Bounds-checked reader over a record payload
+ */
+class PayloadReader {
+private:
+    const char* data;
+    size_t size;
+    size_t position;
+
+public:
+    PayloadReader(const char* data, size_t size) : data(data), size(size), position(0) {}
+
+    bool readU32(uint32_t& value) {
+        if (size - position < sizeof(value)) {
+            return false;
+        }
+        std::memcpy(&value, data + position, sizeof(value));
+        position += sizeof(value);
+        return true;
+    }
+
+    bool readString(std::string& value) {
+        uint32_t length;
+        if (!readU32(length) || size - position < length) {
+            return false;
+        }
+        value.assign(data + position, length);
+        position += length;
+        return true;
+    }
+
+    bool atEnd() const {
+        return position == size;
+    }
+};
+
+/**
+ * @brief Apply one decoded record to a manager
+ * @return false if the payload does not match its type
+ */
+bool applyRecord(StudentManager& manager, Journal::RecordType type, PayloadReader& reader) {
+    uint32_t studentId;
+    if (!reader.readU32(studentId)) {
+        return false;
+    }
+
+    switch (type) {
+        case Journal::RecordType::AddStudent: {
+            uint32_t age, courseCount;
+            std::string name, email, course;
+            if (!reader.readU32(age) || !reader.readString(name) || !reader.readString(email) ||
+                !reader.readU32(courseCount)) {
+                return false;
+            }
+            Student student(static_cast<int>(studentId), std::move(name), std::move(email),
+                            static_cast<int>(age));
+            for (uint32_t i = 0; i < courseCount; ++i) {
+                if (!reader.readString(course)) {
+                    return false;
+                }
+                student.addCourse(course);
+            }
+            std::vector<Student> batch;
+            batch.push_back(std::move(student));
+            manager.bulkLoadStudents(std::move(batch));
+            return reader.atEnd();
+        }
+        case Journal::RecordType::DeleteStudent:
+            manager.deleteStudent(studentId);
+            return reader.atEnd();
+        case Journal::RecordType::EnrollCourse:
+        case Journal::RecordType::RemoveCourse: {
+            std::string course;
+            if (!reader.readString(course) || !reader.atEnd()) {
+                return false;
+            }
+            if (type == Journal::RecordType::EnrollCourse) {
+                manager.enrollStudentInCourse(studentId, course);
+            } else {
+                manager.removeStudentFromCourse(studentId, course);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+/**
+ * @brief Average number of records per batch
+ * @return Records per batch, 0 if nothing was committed
+ */
+double JournalStats::averageBatchRecords() const {
+    return commitCount == 0 ? 0.0 : static_cast<double>(recordsCommitted) / commitCount;
+}
+
+/**
+ * @brief Average latency of a commit
+ * @return Microseconds per batch, 0 if nothing was committed
+ */
+double JournalStats::averageCommitMicros() const {
+    return commitCount == 0 ? 0.0 : static_cast<double>(totalCommitNanos) / commitCount / 1000.0;
+}
+
+/**
+ * @brief Constructor for Journal
+ * @param filePath Path to the journal file
+ */
+Journal::Journal(const std::string& filePath)
+    : journalFilePath(filePath), file(nullptr), recordCount(0),
+      appendedSequence(0), writtenSequence(0), durableSequence(0),
+      failedFirst(1), failedLast(0), commitInProgress(false), stopFlusher(false) {}
+
+/**
+ * @brief Destructor
+ * @details Syncs pending records and closes the file
+ */
+Journal::~Journal() {
+    close();
+}
+
+/**
+ * @brief Open the journal for appending, creating it if needed
+ * @return true if the journal is open, false otherwise
+ */
+bool Journal::open() {
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        if (file) {
+            return true;
+        }
+        file = std::fopen(journalFilePath.c_str(), "ab");
+        if (!file) {
+            std::cerr << "Error: Unable to open journal: " << journalFilePath << std::endl;
+            return false;
+        }
+        std::fseek(file, 0, SEEK_END);
+        if (std::ftell(file) == 0) {
+            std::fwrite(JOURNAL_MAGIC, 1, sizeof(JOURNAL_MAGIC), file);
+        }
+    }
+    startFlusher();
+    return true;
+}
+
+/**
+ * @brief Sync pending records and close the journal
+ */
+void Journal::close() {
+    stopFlusherThread();
+    std::unique_lock<std::mutex> lock(mutex);
+    if (file) {
+        commit(lock, appendedSequence, true);
+        committed.wait(lock, [this] { return !commitInProgress; });
+        std::fclose(file);
+        file = nullptr;
+    }
+}
+
+/**
+ * @brief Choose when records are committed
+ * @param newPolicy The commit strategy
+ */
+void Journal::setDurabilityPolicy(const DurabilityPolicy& newPolicy) {
+    stopFlusherThread();
+    sync();
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        policy = newPolicy;
+    }
+    startFlusher();
+}
+
+/**
+ * @brief Get the commit strategy
+ * @return The current policy
+ */
+DurabilityPolicy Journal::getDurabilityPolicy() const {
+    std::lock_guard<std::mutex> guard(mutex);
+    return policy;
+}
+
+/**
+ * @brief Get the group-commit counters
+ * @return Copy of the counters
+ */
+JournalStats Journal::getStats() const {
+    std::lock_guard<std::mutex> guard(mutex);
+    return stats;
+}
+
+/**
+ * @brief Check whether the journal is open
+ * @return true if open() succeeded and close() was not called since
+ */
+bool Journal::isOpen() const {
+    std::lock_guard<std::mutex> guard(mutex);
+    return file != nullptr;
+}
+
+/**
+ * @brief Encode a record and add it to the pending batch
+ * @param type Record type
+ * @param payload Encoded payload
+ * @return Sequence number of the record
+ */
+uint64_t Journal::append(RecordType type, const std::string& payload) {
+    uint8_t typeByte = static_cast<uint8_t>(type);
+    uint32_t sum = checksum(typeByte, payload.data(), payload.size());
+
+    std::lock_guard<std::mutex> guard(mutex);
+    putU32(pending, static_cast<uint32_t>(payload.size()));
+    putU32(pending, sum);
+    pending += static_cast<char>(typeByte);
+    pending += payload;
+    ++recordCount;
+    return ++appendedSequence;
+}
+
+/**
+ * @brief Wait until a record is committed, committing it if nobody else is
+ * @param lock Held lock on mutex; released while the file is written
+ * @param sequence Record that has to be committed
+ * @param durable true to wait for fsync, false to wait for the write only
+ * @return true if the record was committed, false if its batch failed
+ * @details The first thread to find no commit in progress becomes the leader:
+ *          it takes every pending record, writes them with one fwrite and,
+ *          if durable, one fsync, then wakes the others. Threads arriving
+ *          while a leader is busy wait and are usually covered by its batch
+ *          or by the next one, so N concurrent committers cost far fewer
+ *          than N fsyncs. A failed batch still advances the sequence numbers
+ *          so waiters never hang; they see the failure in the return value.
+ */
+bool Journal::commit(std::unique_lock<std::mutex>& lock, uint64_t sequence, bool durable) {
+    auto covered = [this, sequence, durable] {
+        return (durable ? durableSequence : writtenSequence) >= sequence;
+    };
+
+    while (!covered()) {
+        if (commitInProgress) {
+            committed.wait(lock);
+            continue;
+        }
+        if (!file) {
+            return false;
+        }
+
+        // Become the leader for everything appended so far
+        commitInProgress = true;
+        std::string batch;
+        batch.swap(pending);
+        uint64_t batchFirst = writtenSequence + 1;
+        uint64_t batchLast = appendedSequence;
+        uint64_t batchRecords = batchLast - writtenSequence;
+        std::FILE* out = file;
+        lock.unlock();
+
+        auto started = std::chrono::steady_clock::now();
+        bool ok = batch.empty() || std::fwrite(batch.data(), 1, batch.size(), out) == batch.size();
+        ok = ok && std::fflush(out) == 0;
+        if (ok && durable) {
+#if !defined(_WIN32)
+            ok = ::fsync(::fileno(out)) == 0;
+#else
+            ok = ::_commit(::_fileno(out)) == 0;
+#endif
+        }
+        uint64_t nanos = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - started).count());
+
+        lock.lock();
+        commitInProgress = false;
+        writtenSequence = batchLast;
+        if (durable) {
+            durableSequence = batchLast;
+        }
+
+        ++stats.commitCount;
+        stats.syncCount += durable ? 1 : 0;
+        stats.recordsCommitted += batchRecords;
+        stats.maxBatchRecords = std::max(stats.maxBatchRecords, batchRecords);
+        stats.totalCommitNanos += nanos;
+        stats.maxCommitNanos = std::max(stats.maxCommitNanos, nanos);
+        if (batchRecords > 0) {
+            size_t bucket = 0;
+            while (bucket + 1 < JournalStats::BATCH_BUCKETS && (batchRecords >> (bucket + 1)) != 0) {
+                ++bucket;
+            }
+            ++stats.batchSizeHistogram[bucket];
+        }
+        if (!ok) {
+            ++stats.failedCommits;
+            failedFirst = batchFirst;
+            failedLast = batchLast;
+            std::cerr << "Error: Unable to write journal: " << journalFilePath << std::endl;
+        }
+        committed.notify_all();
+    }
+    return sequence < failedFirst || sequence > failedLast;
+}
+
+/**
+ * @brief Start the background flusher if the policy needs one
+ */
+void Journal::startFlusher() {
+    std::lock_guard<std::mutex> guard(mutex);
+    if (policy.mode == DurabilityPolicy::Mode::Interval && file && !flusher.joinable()) {
+        stopFlusher = false;
+        flusher = std::thread(&Journal::flusherLoop, this);
+    }
+}
+
+/**
+ * @brief Stop and join the background flusher, if it runs
+ */
+void Journal::stopFlusherThread() {
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        if (!flusher.joinable()) {
+            return;
+        }
+        stopFlusher = true;
+    }
+    flusherWakeup.notify_all();
+    flusher.join();
+}
+
+/**
+ * @brief Body of the Mode::Interval flusher thread
+ * @details Commits whatever was appended every intervalMs milliseconds
+ */
+void Journal::flusherLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!stopFlusher) {
+        flusherWakeup.wait_for(lock, std::chrono::milliseconds(policy.intervalMs),
+                               [this] { return stopFlusher; });
+        if (!stopFlusher && appendedSequence > durableSequence) {
+            commit(lock, appendedSequence, true);
+        }
+    }
+}
+
+/**
+ * @brief Record that a student was added
+ * @param student The student as stored, including its assigned ID
+ * @return Sequence number of the record
+ */
+uint64_t Journal::recordAddStudent(const Student& student) {
+    std::string payload;
+    putU32(payload, static_cast<uint32_t>(student.getStudentId()));
+    putU32(payload, static_cast<uint32_t>(student.getAge()));
+    putString(payload, student.getName());
+    putString(payload, student.getEmail());
+    const CourseDictionary& dictionary = CourseDictionary::instance();
+    const std::vector<uint32_t>& courseIds = student.getCourseIds();
+    putU32(payload, static_cast<uint32_t>(courseIds.size()));
+    for (uint32_t courseId : courseIds) {
+        putString(payload, dictionary.name(courseId));
+    }
+    return append(RecordType::AddStudent, payload);
+}
+
+/**
+ * @brief Record that a student was deleted
+ * @param studentId ID of the deleted student
+ * @return Sequence number of the record
+ */
+uint64_t Journal::recordDeleteStudent(uint32_t studentId) {
+    std::string payload;
+    putU32(payload, studentId);
+    return append(RecordType::DeleteStudent, payload);
+}
+
+/**
+ * @brief Record that a student was enrolled in a course
+ * @param studentId ID of the student
+ * @param course Name of the course
+ * @return Sequence number of the record
+ */
+uint64_t Journal::recordEnrollment(uint32_t studentId, const std::string& course) {
+    std::string payload;
+    putU32(payload, studentId);
+    putString(payload, course);
+    return append(RecordType::EnrollCourse, payload);
+}
+
+/**
+ * @brief Record that a student was removed from a course
+ * @param studentId ID of the student
+ * @param course Name of the course
+ * @return Sequence number of the record
+ */
+uint64_t Journal::recordCourseRemoval(uint32_t studentId, const std::string& course) {
+    std::string payload;
+    putU32(payload, studentId);
+    putString(payload, course);
+    return append(RecordType::RemoveCourse, payload);
+}
+
+/**
+ * @brief Apply the durability policy to a recorded mutation
+ * @param sequence Sequence number returned by a record* method
+ * @return false if a commit made for this record failed
+ */
+bool Journal::commitPerPolicy(uint64_t sequence) {
+    std::unique_lock<std::mutex> lock(mutex);
+    switch (policy.mode) {
+        case DurabilityPolicy::Mode::EveryOperation:
+            return commit(lock, sequence, true);
+        case DurabilityPolicy::Mode::OsManaged:
+            return commit(lock, sequence, false);
+        case DurabilityPolicy::Mode::OperationCount:
+            if (appendedSequence - writtenSequence >= policy.operationCount) {
+                return commit(lock, appendedSequence, true);
+            }
+            return true;
+        case DurabilityPolicy::Mode::Interval:
+        case DurabilityPolicy::Mode::Manual:
+            break;
+    }
+    return true;
+}
+
+/**
+ * @brief Write pending records and flush them to stable storage
+ * @return true if every appended record is durable, false otherwise
+ * @details The whole pending batch is written with one write and made
+ *          durable with one fsync
+ */
+bool Journal::sync() {
+    std::unique_lock<std::mutex> lock(mutex);
+    return commit(lock, appendedSequence, true);
+}
+
+/**
+ * @brief Apply the records stored in the journal file to a manager
+ * @param manager StudentManager to apply the records to
+ * @return Number of records applied
+ */
+uint64_t Journal::replay(StudentManager& manager) {
+    std::vector<char> bytes;
+    {
+        std::ifstream inFile(journalFilePath, std::ios::binary);
+        if (!inFile.is_open()) {
+            return 0;
+        }
+        bytes.assign(std::istreambuf_iterator<char>(inFile), std::istreambuf_iterator<char>());
+    }
+    if (bytes.empty()) {
+        return 0;
+    }
+    if (bytes.size() < sizeof(JOURNAL_MAGIC) ||
+        std::memcmp(bytes.data(), JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC)) != 0) {
+        std::cerr << "Error: Not a journal file: " << journalFilePath << std::endl;
+        return 0;
+    }
+
+    Journal* attached = manager.getJournal();
+    manager.setJournal(nullptr);
+
+    uint64_t applied = 0;
+    size_t position = sizeof(JOURNAL_MAGIC);
+    while (bytes.size() - position >= RECORD_HEADER_SIZE) {
+        uint32_t length, expected;
+        std::memcpy(&length, bytes.data() + position, sizeof(length));
+        std::memcpy(&expected, bytes.data() + position + sizeof(length), sizeof(expected));
+        uint8_t type = static_cast<uint8_t>(bytes[position + 2 * sizeof(uint32_t)]);
+        const char* payload = bytes.data() + position + RECORD_HEADER_SIZE;
+
+        if (bytes.size() - position - RECORD_HEADER_SIZE < length ||
+            checksum(type, payload, length) != expected) {
+            break;
+        }
+        PayloadReader reader(payload, length);
+        if (!applyRecord(manager, static_cast<RecordType>(type), reader)) {
+            break;
+        }
+        ++applied;
+        position += RECORD_HEADER_SIZE + length;
+    }
+
+    manager.setJournal(attached);
+
+    // Cut off a record torn by a crash so new records are not appended after it
+    if (position < bytes.size()) {
+        std::cerr << "Warning: Discarding " << (bytes.size() - position)
+                  << " bytes of incomplete journal data." << std::endl;
+        std::error_code error;
+        std::filesystem::resize_file(journalFilePath, position, error);
+    }
+
+    std::lock_guard<std::mutex> guard(mutex);
+    recordCount += applied;
+    return applied;
+}
+
+/**
+ * @brief Empty the journal after its records were checkpointed
+ * @return true if the journal was truncated, false otherwise
+ * @details Pending records are dropped as well, since the checkpoint
+ *          already contains them
+ */
+bool Journal::reset() {
+    return reset(std::numeric_limits<uint64_t>::max());
+}
+
+/**
+ * @brief Drop the records a checkpoint contains, keeping later ones
+ * @param throughSequence Last record the checkpoint contains
+ * @return true if the journal was rewritten, false otherwise
+ * @details Records appended after throughSequence are written out first and
+ *          copied into the new journal. The new journal is written under a
+ *          temporary name, synced and renamed into place, so a crash leaves
+ *          either the old or the new journal.
+ */
+bool Journal::reset(uint64_t throughSequence) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (throughSequence >= appendedSequence) {
+        committed.wait(lock, [this] { return !commitInProgress; });
+        pending.clear();
+    } else {
+        // Get every record into the file; appenders wait while it is rewritten below
+        for (;;) {
+            committed.wait(lock, [this] { return !commitInProgress; });
+            if (writtenSequence == appendedSequence) {
+                break;
+            }
+            if (!commit(lock, appendedSequence, false)) {
+                return false;
+            }
+        }
+    }
+    uint64_t keep = appendedSequence - std::min(throughSequence, appendedSequence);
+
+    // The records to keep are the last keep records of the file
+    std::string tail;
+    if (keep > 0) {
+        std::vector<char> bytes;
+        {
+            std::ifstream inFile(journalFilePath, std::ios::binary);
+            bytes.assign(std::istreambuf_iterator<char>(inFile), std::istreambuf_iterator<char>());
+        }
+        std::vector<size_t> offsets;
+        size_t position = sizeof(JOURNAL_MAGIC);
+        while (position < bytes.size() && bytes.size() - position >= RECORD_HEADER_SIZE) {
+            uint32_t length;
+            std::memcpy(&length, bytes.data() + position, sizeof(length));
+            if (bytes.size() - position - RECORD_HEADER_SIZE < length) {
+                break;
+            }
+            offsets.push_back(position);
+            position += RECORD_HEADER_SIZE + length;
+        }
+        if (offsets.size() < keep) {
+            std::cerr << "Error: Unable to reset journal: " << journalFilePath << std::endl;
+            return false;
+        }
+        tail.assign(bytes.data() + offsets[offsets.size() - keep], bytes.data() + position);
+    }
+
+    const std::string tempPath = journalFilePath + ".tmp";
+    std::FILE* rewritten = std::fopen(tempPath.c_str(), "wb");
+    bool ok = rewritten != nullptr;
+    ok = ok && std::fwrite(JOURNAL_MAGIC, 1, sizeof(JOURNAL_MAGIC), rewritten) == sizeof(JOURNAL_MAGIC);
+    ok = ok && (tail.empty() || std::fwrite(tail.data(), 1, tail.size(), rewritten) == tail.size());
+    if (rewritten) {
+        ok = std::fclose(rewritten) == 0 && ok;
+    }
+    if (!ok || !replaceFileDurably(tempPath, journalFilePath)) {
+        std::remove(tempPath.c_str());
+        std::cerr << "Error: Unable to reset journal: " << journalFilePath << std::endl;
+        return false;
+    }
+
+    // Reopen so appends go to the new file rather than the replaced one
+    if (file) {
+        std::fclose(file);
+        file = std::fopen(journalFilePath.c_str(), "ab");
+        if (!file) {
+            std::cerr << "Error: Unable to open journal: " << journalFilePath << std::endl;
+            committed.notify_all();
+            return false;
+        }
+    }
+    recordCount = keep;
+    writtenSequence = appendedSequence;
+    durableSequence = appendedSequence;
+    committed.notify_all();
+    return true;
+}
+
+/**
+ * @brief Get the sequence number of the last appended record
+ * @return Sequence number, 0 if nothing was appended since construction
+ */
+uint64_t Journal::getAppendedSequence() const {
+    std::lock_guard<std::mutex> guard(mutex);
+    return appendedSequence;
+}
+
+/**
+ * @brief Get the number of records appended but not yet written to the file
+ * @return Pending record count
+ */
+uint64_t Journal::getPendingRecordCount() const {
+    std::lock_guard<std::mutex> guard(mutex);
+    return appendedSequence - writtenSequence;
+}
+
+/**
+ * @brief Get the number of records in the journal since the last reset
+ * @return Record count, including pending records
+ */
+uint64_t Journal::getRecordCount() const {
+    std::lock_guard<std::mutex> guard(mutex);
+    return recordCount;
+}
+
+/**
+ * @brief Get the path of the journal file
+ * @return Journal file path
+ */
+const std::string& Journal::getPath() const {
+    return journalFilePath;
+}
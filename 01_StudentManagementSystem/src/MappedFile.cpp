@@ -0,0 +1,110 @@
+#include "MappedFile.h"
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#include <iterator>
+#endif
+
+/**
+ * @brief Default constructor
+ * @details Creates a closed mapping
+ */
+MappedFile::MappedFile() : mappedData(nullptr), mappedSize(0) {}
+
+/**
+ * @brief Destructor
+ * @details Unmaps the file if it is still mapped
+ */
+MappedFile::~MappedFile() {
+    close();
+}
+
+/**
+ * @brief Map a file
+ * @param filePath Path of the file to map
+ * @return true if the file was mapped, false otherwise
+ */
+bool MappedFile::open(const std::string& filePath) {
+    close();
+
+#if !defined(_WIN32)
+    int fd = ::open(filePath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || info.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+
+    void* address = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    // The mapping keeps its own reference to the file
+    ::close(fd);
+    if (address == MAP_FAILED) {
+        return false;
+    }
+
+    mappedData = static_cast<const char*>(address);
+    mappedSize = static_cast<size_t>(info.st_size);
+#else
+    std::ifstream inFile(filePath, std::ios::binary);
+    if (!inFile.is_open()) {
+        return false;
+    }
+    fallback.assign(std::istreambuf_iterator<char>(inFile), std::istreambuf_iterator<char>());
+    if (fallback.empty()) {
+        return false;
+    }
+    mappedData = fallback.data();
+    mappedSize = fallback.size();
+#endif
+    return true;
+}
+
+/**
+ * @brief Release the mapping
+ */
+void MappedFile::close() {
+    if (mappedData == nullptr) {
+        return;
+    }
+#if !defined(_WIN32)
+    ::munmap(const_cast<char*>(mappedData), mappedSize);
+#else
+    fallback.clear();
+    fallback.shrink_to_fit();
+#endif
+    mappedData = nullptr;
+    mappedSize = 0;
+}
+
+/**
+ * @brief Check whether a file is mapped
+ * @return true if a file is mapped, false otherwise
+ */
+bool MappedFile::isOpen() const {
+    return mappedData != nullptr;
+}
+
+/**
+ * @brief Get the mapped bytes
+ * @return Start of the mapping, nullptr when closed
+ */
+const char* MappedFile::data() const {
+    return mappedData;
+}
+
+/**
+ * @brief Get the size of the mapping
+ * @return Number of mapped bytes
+ */
+std::size_t MappedFile::size() const {
+    return mappedSize;
+}
@@ -0,0 +1,56 @@
+#include "NamePrefixIndex.h"
+#include "TrigramIndex.h"
+
+/**
+ * @brief Index a name
+ * @param studentId ID of the student
+ * @param name Name as stored in the Student
+ */
+void NamePrefixIndex::add(uint32_t studentId, std::string_view name) {
+    entries.emplace(TrigramIndex::fold(name), studentId);
+}
+
+/**
+ * @brief Remove a previously indexed name
+ * @param studentId ID of the student
+ * @param name Name the student was indexed with
+ */
+void NamePrefixIndex::remove(uint32_t studentId, std::string_view name) {
+    entries.erase(std::make_pair(TrigramIndex::fold(name), studentId));
+}
+
+/**
+ * @brief Drop every entry
+ */
+void NamePrefixIndex::clear() {
+    entries.clear();
+}
+
+/**
+ * @brief Find the students whose names start with a prefix
+ * @param foldedPrefix Prefix already passed through TrigramIndex::fold()
+ * @param limit Maximum number of IDs to return
+ * @return IDs ordered by folded name, then by ID
+ * @details (prefix, 0) sorts before every name that starts with the prefix,
+ *          so the walk starts at the first match and stops at the first
+ *          entry that no longer shares the prefix.
+ */
+std::vector<uint32_t> NamePrefixIndex::find(std::string_view foldedPrefix, std::size_t limit) const {
+    std::vector<uint32_t> result;
+    auto it = entries.lower_bound(std::make_pair(std::string(foldedPrefix), uint32_t{0}));
+    for (; it != entries.end() && result.size() < limit; ++it) {
+        if (it->first.compare(0, foldedPrefix.size(), foldedPrefix) != 0) {
+            break;
+        }
+        result.push_back(it->second);
+    }
+    return result;
+}
+
+/**
+ * @brief Get the number of indexed names
+ * @return Entry count
+ */
+std::size_t NamePrefixIndex::size() const {
+    return entries.size();
+}
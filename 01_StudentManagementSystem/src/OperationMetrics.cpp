@@ -0,0 +1,354 @@
+#include "OperationMetrics.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <sstream>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Buffers of the live threads and the metrics of the exited ones
+ */
+struct MetricsRegistry {
+    std::mutex mutex;                          ///< Guards everything below
+    std::vector<MetricsThreadBuffer*> live;    ///< Buffers of running threads
+    MetricsReport retired;                     ///< Sum of the buffers of exited threads
+};
+
+/**
+ * @brief Get the process-wide registry
+ * @return The registry
+ * @details Never destroyed, so threads exiting after static destruction
+ *          has begun can still hand their buffers in
+ */
+MetricsRegistry& registry() {
+    static MetricsRegistry* instance = new MetricsRegistry();
+    return *instance;
+}
+
+/**
+ * @brief Add a thread's buffer to a report
+ * @param report Report to add to
+ * @param buffer Buffer to add
+ */
+void addBuffer(MetricsReport& report, MetricsThreadBuffer& buffer) {
+    for (size_t i = 0; i < OPERATION_COUNT; ++i) {
+        report.get(static_cast<Operation>(i)).calls += buffer.calls[i].load(std::memory_order_relaxed);
+    }
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    for (size_t i = 0; i < OPERATION_COUNT; ++i) {
+        report.get(static_cast<Operation>(i)).latency.merge(buffer.latency[i]);
+    }
+}
+
+/**
+ * @brief Owns the calling thread's buffer and retires it when the thread exits
+ */
+struct ThreadBufferOwner {
+    MetricsThreadBuffer* buffer = nullptr;
+
+    ~ThreadBufferOwner() {
+        if (!buffer) {
+            return;
+        }
+        MetricsRegistry& metrics = registry();
+        std::lock_guard<std::mutex> lock(metrics.mutex);
+        addBuffer(metrics.retired, *buffer);
+        metrics.live.erase(std::find(metrics.live.begin(), metrics.live.end(), buffer));
+        delete buffer;
+        currentMetricsBuffer = nullptr;
+    }
+};
+
+thread_local ThreadBufferOwner threadBufferOwner;
+
+/**
+ * @brief Format nanoseconds as microseconds with two decimals
+ * @param nanos Duration in nanoseconds
+ * @return Formatted number
+ */
+std::string micros(double nanos) {
+    char text[32];
+    std::snprintf(text, sizeof(text), "%.2f", nanos / 1000.0);
+    return text;
+}
+
+} // namespace
+
+/**
+ * @brief Get the name of an operation as used in the text and JSON reports
+ * @param operation The operation
+ * @return Name such as "addStudent"
+ */
+const char* operationName(Operation operation) {
+    switch (operation) {
+        case Operation::AddStudent: return "addStudent";
+        case Operation::BulkLoadStudents: return "bulkLoadStudents";
+        case Operation::DeleteStudent: return "deleteStudent";
+        case Operation::GetStudent: return "getStudent";
+        case Operation::SearchStudents: return "searchStudents";
+        case Operation::EnrollInCourse: return "enrollStudentInCourse";
+        case Operation::RemoveFromCourse: return "removeStudentFromCourse";
+        case Operation::GetAllStudents: return "getAllStudents";
+        case Operation::LoadStudents: return "loadStudents";
+        case Operation::SaveStudents: return "saveStudents";
+        case Operation::LoadSnapshot: return "loadSnapshot";
+        case Operation::SaveSnapshot: return "saveSnapshot";
+    }
+    return "unknown";
+}
+
+/**
+ * @brief Find the bucket of a value
+ * @param nanos Latency in nanoseconds
+ * @return Bucket index
+ * @details Values below SUB_BUCKETS have a bucket each. Above, the bucket is
+ *          given by the position of the highest set bit and the
+ *          SUB_BUCKET_BITS bits below it.
+ */
+size_t LatencyHistogram::bucketFor(uint64_t nanos) {
+    if (nanos < SUB_BUCKETS) {
+        return static_cast<size_t>(nanos);
+    }
+    unsigned exponent = 63 - static_cast<unsigned>(__builtin_clzll(nanos));
+    if (exponent > MAX_EXPONENT) {
+        return BUCKET_COUNT - 1;
+    }
+    size_t subBucket = static_cast<size_t>(nanos >> (exponent - SUB_BUCKET_BITS)) - SUB_BUCKETS;
+    return (exponent - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + subBucket;
+}
+
+/**
+ * @brief Get the largest value that falls into a bucket
+ * @param bucket Bucket index
+ * @return Upper bound in nanoseconds
+ */
+uint64_t LatencyHistogram::bucketUpperBound(size_t bucket) {
+    if (bucket < SUB_BUCKETS) {
+        return bucket;
+    }
+    unsigned exponent = static_cast<unsigned>(bucket / SUB_BUCKETS) + SUB_BUCKET_BITS - 1;
+    uint64_t lower = static_cast<uint64_t>(SUB_BUCKETS + bucket % SUB_BUCKETS) << (exponent - SUB_BUCKET_BITS);
+    return lower + (uint64_t(1) << (exponent - SUB_BUCKET_BITS)) - 1;
+}
+
+/**
+ * @brief Record one latency
+ * @param nanos Latency in nanoseconds
+ */
+void LatencyHistogram::record(uint64_t nanos) {
+    buckets[bucketFor(nanos)]++;
+    minNanos = count == 0 ? nanos : std::min(minNanos, nanos);
+    maxNanos = std::max(maxNanos, nanos);
+    totalNanos += nanos;
+    count++;
+}
+
+/**
+ * @brief Add the values of another histogram
+ * @param other Histogram to add
+ */
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    if (other.count == 0) {
+        return;
+    }
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        buckets[i] += other.buckets[i];
+    }
+    minNanos = count == 0 ? other.minNanos : std::min(minNanos, other.minNanos);
+    maxNanos = std::max(maxNanos, other.maxNanos);
+    totalNanos += other.totalNanos;
+    count += other.count;
+}
+
+/**
+ * @brief Forget every recorded value
+ */
+void LatencyHistogram::clear() {
+    *this = LatencyHistogram();
+}
+
+/**
+ * @brief Get the number of recorded values
+ * @return Value count
+ */
+uint64_t LatencyHistogram::getCount() const {
+    return count;
+}
+
+/**
+ * @brief Get the smallest recorded value
+ * @return Minimum in nanoseconds, 0 when empty
+ */
+uint64_t LatencyHistogram::getMin() const {
+    return minNanos;
+}
+
+/**
+ * @brief Get the largest recorded value
+ * @return Maximum in nanoseconds, 0 when empty
+ */
+uint64_t LatencyHistogram::getMax() const {
+    return maxNanos;
+}
+
+/**
+ * @brief Get the average recorded value
+ * @return Mean in nanoseconds, 0 when empty
+ */
+double LatencyHistogram::getMean() const {
+    return count == 0 ? 0.0 : static_cast<double>(totalNanos) / static_cast<double>(count);
+}
+
+/**
+ * @brief Get a percentile of the recorded values
+ * @param percentile Percentile between 0 and 100
+ * @return Upper bound of the bucket holding the percentile, capped at the
+ *         maximum; 0 when empty
+ */
+uint64_t LatencyHistogram::getPercentile(double percentile) const {
+    if (count == 0) {
+        return 0;
+    }
+    double clamped = std::min(100.0, std::max(0.0, percentile));
+    uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(clamped / 100.0 * static_cast<double>(count))));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        seen += buckets[i];
+        if (seen >= rank) {
+            return std::max(minNanos, std::min(bucketUpperBound(i), maxNanos));
+        }
+    }
+    return maxNanos;
+}
+
+/**
+ * @brief Get the metrics of one operation
+ * @param operation The operation
+ * @return Its call count and latency histogram
+ */
+const OperationStats& MetricsReport::get(Operation operation) const {
+    return operations[static_cast<size_t>(operation)];
+}
+
+/**
+ * @brief Get the metrics of one operation for modification
+ * @param operation The operation
+ * @return Its call count and latency histogram
+ */
+OperationStats& MetricsReport::get(Operation operation) {
+    return operations[static_cast<size_t>(operation)];
+}
+
+/**
+ * @brief Format the report as an aligned table
+ * @return One line per operation with calls, samples and latency percentiles in microseconds
+ */
+std::string MetricsReport::toText() const {
+    std::ostringstream out;
+    char line[160];
+    std::snprintf(line, sizeof(line), "%-24s %12s %10s %10s %10s %10s %10s %10s\n", "operation", "calls",
+                  "sampled", "mean_us", "p50_us", "p90_us", "p99_us", "max_us");
+    out << line;
+    for (size_t i = 0; i < OPERATION_COUNT; ++i) {
+        const OperationStats& stats = operations[i];
+        const LatencyHistogram& latency = stats.latency;
+        std::snprintf(line, sizeof(line), "%-24s %12llu %10llu %10s %10s %10s %10s %10s\n",
+                      operationName(static_cast<Operation>(i)),
+                      static_cast<unsigned long long>(stats.calls),
+                      static_cast<unsigned long long>(latency.getCount()),
+                      micros(latency.getMean()).c_str(),
+                      micros(static_cast<double>(latency.getPercentile(50))).c_str(),
+                      micros(static_cast<double>(latency.getPercentile(90))).c_str(),
+                      micros(static_cast<double>(latency.getPercentile(99))).c_str(),
+                      micros(static_cast<double>(latency.getMax())).c_str());
+        out << line;
+    }
+    return out.str();
+}
+
+/**
+ * @brief Format the report as JSON
+ * @return Object keyed by operation name; latencies in nanoseconds
+ */
+std::string MetricsReport::toJson() const {
+    std::ostringstream out;
+    out << "{";
+    for (size_t i = 0; i < OPERATION_COUNT; ++i) {
+        const OperationStats& stats = operations[i];
+        const LatencyHistogram& latency = stats.latency;
+        out << (i ? "," : "") << "\"" << operationName(static_cast<Operation>(i)) << "\":{"
+            << "\"calls\":" << stats.calls
+            << ",\"sampled\":" << latency.getCount()
+            << ",\"min_ns\":" << latency.getMin()
+            << ",\"mean_ns\":" << static_cast<uint64_t>(latency.getMean())
+            << ",\"p50_ns\":" << latency.getPercentile(50)
+            << ",\"p90_ns\":" << latency.getPercentile(90)
+            << ",\"p99_ns\":" << latency.getPercentile(99)
+            << ",\"p999_ns\":" << latency.getPercentile(99.9)
+            << ",\"max_ns\":" << latency.getMax() << "}";
+    }
+    out << "}";
+    return out.str();
+}
+
+/**
+ * @brief Create and register the calling thread's buffer
+ * @return The new buffer
+ */
+MetricsThreadBuffer* OperationMetrics::registerThread() {
+    MetricsThreadBuffer* created = new MetricsThreadBuffer();
+    {
+        MetricsRegistry& metrics = registry();
+        std::lock_guard<std::mutex> lock(metrics.mutex);
+        metrics.live.push_back(created);
+    }
+    threadBufferOwner.buffer = created;
+    currentMetricsBuffer = created;
+    return created;
+}
+
+/**
+ * @brief Record the latency of a sampled call
+ * @param buffer Buffer of the calling thread
+ * @param operation The operation
+ * @param nanos Latency in nanoseconds
+ */
+void OperationMetrics::recordLatency(MetricsThreadBuffer& buffer, Operation operation, uint64_t nanos) {
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    buffer.latency[static_cast<size_t>(operation)].record(nanos);
+}
+
+/**
+ * @brief Sum the metrics of all threads
+ * @return The report
+ */
+MetricsReport OperationMetrics::collect() {
+    MetricsRegistry& metrics = registry();
+    std::lock_guard<std::mutex> lock(metrics.mutex);
+    MetricsReport report = metrics.retired;
+    for (MetricsThreadBuffer* buffer : metrics.live) {
+        addBuffer(report, *buffer);
+    }
+    return report;
+}
+
+/**
+ * @brief Zero the metrics of all threads
+ * @details Calls counted while the reset runs may survive it
+ */
+void OperationMetrics::reset() {
+    MetricsRegistry& metrics = registry();
+    std::lock_guard<std::mutex> lock(metrics.mutex);
+    metrics.retired = MetricsReport();
+    for (MetricsThreadBuffer* buffer : metrics.live) {
+        for (auto& calls : buffer->calls) {
+            calls.store(0, std::memory_order_relaxed);
+        }
+        std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+        for (auto& latency : buffer->latency) {
+            latency.clear();
+        }
+    }
+}
@@ -0,0 +1,469 @@
+#include "RoaringBitmap.h"
+#include <algorithm>
+#include <iterator>
+
+namespace {
+
+/**
+ * @brief Count the set bits of count words without a popcount instruction
+ * @details Classic SWAR reduction; the loop has no dependencies between
+ *          words, so the compiler vectorizes it
+ */
+uint32_t countBitsPortable(const uint64_t* words, std::size_t count) {
+    uint64_t bits = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        uint64_t word = words[i];
+        word = word - ((word >> 1) & 0x5555555555555555ULL);
+        word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+        word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        bits += (word * 0x0101010101010101ULL) >> 56;
+    }
+    return static_cast<uint32_t>(bits);
+}
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define SMS_ROARING_POPCNT 1
+
+/**
+ * @brief Count the set bits of count words with the POPCNT instruction
+ */
+__attribute__((target("popcnt"))) uint32_t countBitsPopcnt(const uint64_t* words, std::size_t count) {
+    uint64_t bits = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        bits += static_cast<uint64_t>(__builtin_popcountll(words[i]));
+    }
+    return static_cast<uint32_t>(bits);
+}
+#endif
+
+/**
+ * @brief Count the set bits of count words
+ * @details Without -mpopcnt __builtin_popcountll is a library call, so the
+ *          POPCNT version is picked at runtime when the CPU has it
+ */
+uint32_t countBits(const uint64_t* words, std::size_t count) {
+#ifdef SMS_ROARING_POPCNT
+    static const bool hasPopcnt = (__builtin_cpu_init(), __builtin_cpu_supports("popcnt"));
+    if (hasPopcnt) {
+        return countBitsPopcnt(words, count);
+    }
+#endif
+    return countBitsPortable(words, count);
+}
+
+} // namespace
+
+/**
+ * @brief Switch a container to the bitmap representation
+ * @param container Array container to convert
+ */
+void RoaringBitmap::toBitmap(Container& container) {
+    container.words.assign(WORDS, 0);
+    for (uint16_t low : container.values) {
+        container.words[low >> 6] |= uint64_t(1) << (low & 63);
+    }
+    container.values.clear();
+    container.values.shrink_to_fit();
+}
+
+/**
+ * @brief Switch a container to the array representation
+ * @param container Bitmap container to convert
+ */
+void RoaringBitmap::toArray(Container& container) {
+    container.values.clear();
+    container.values.reserve(container.cardinality);
+    for (std::size_t i = 0; i < WORDS; ++i) {
+        for (uint64_t word = container.words[i]; word != 0; word &= word - 1) {
+            container.values.push_back(static_cast<uint16_t>(i * 64 + __builtin_ctzll(word)));
+        }
+    }
+    container.words.clear();
+    container.words.shrink_to_fit();
+}
+
+/**
+ * @brief Pick the representation that matches the cardinality
+ * @param container Container to fix up
+ * @details Containers with more than ARRAY_LIMIT values are bitmaps, all
+ *          others arrays, so equal sets always have equal representations
+ */
+void RoaringBitmap::normalize(Container& container) {
+    if (container.isBitmap() && container.cardinality <= ARRAY_LIMIT) {
+        toArray(container);
+    } else if (!container.isBitmap() && container.cardinality > ARRAY_LIMIT) {
+        toBitmap(container);
+    }
+}
+
+/**
+ * @brief Intersect two containers with the same key
+ * @param a First container
+ * @param b Second container
+ * @return Normalized result, possibly empty
+ */
+RoaringBitmap::Container RoaringBitmap::intersect(const Container& a, const Container& b) {
+    Container result;
+    result.key = a.key;
+    if (a.isBitmap() && b.isBitmap()) {
+        result.words.resize(WORDS);
+        for (std::size_t i = 0; i < WORDS; ++i) {
+            result.words[i] = a.words[i] & b.words[i];
+        }
+        result.cardinality = countBits(result.words.data(), WORDS);
+    } else if (a.isBitmap() || b.isBitmap()) {
+        const Container& array = a.isBitmap() ? b : a;
+        const Container& bitmap = a.isBitmap() ? a : b;
+        result.values.reserve(array.values.size());
+        for (uint16_t low : array.values) {
+            if (bitmap.words[low >> 6] & (uint64_t(1) << (low & 63))) {
+                result.values.push_back(low);
+            }
+        }
+        result.cardinality = static_cast<uint32_t>(result.values.size());
+    } else {
+        std::set_intersection(a.values.begin(), a.values.end(), b.values.begin(), b.values.end(),
+                              std::back_inserter(result.values));
+        result.cardinality = static_cast<uint32_t>(result.values.size());
+    }
+    normalize(result);
+    return result;
+}
+
+/**
+ * @brief Unite a container with another one with the same key
+ * @param a Container to add to; reused for the result
+ * @param b Container whose values are added
+ * @details A bitmap container is updated in place, so a long chain of
+ *          unions allocates each bitmap only once
+ */
+void RoaringBitmap::unite(Container& a, const Container& b) {
+    if (!a.isBitmap() && !b.isBitmap() && a.cardinality + b.cardinality <= ARRAY_LIMIT) {
+        std::vector<uint16_t> merged;
+        merged.reserve(a.values.size() + b.values.size());
+        std::set_union(a.values.begin(), a.values.end(), b.values.begin(), b.values.end(),
+                       std::back_inserter(merged));
+        a.values = std::move(merged);
+        a.cardinality = static_cast<uint32_t>(a.values.size());
+        return;
+    }
+
+    if (!a.isBitmap()) {
+        toBitmap(a);
+    }
+    if (b.isBitmap()) {
+        for (std::size_t i = 0; i < WORDS; ++i) {
+            a.words[i] |= b.words[i];
+        }
+    } else {
+        for (uint16_t low : b.values) {
+            a.words[low >> 6] |= uint64_t(1) << (low & 63);
+        }
+    }
+    a.cardinality = countBits(a.words.data(), WORDS);
+    normalize(a);
+}
+
+/**
+ * @brief Remove the values of one container from another with the same key
+ * @param a Container to subtract from
+ * @param b Container whose values are removed
+ * @return Normalized result, possibly empty
+ */
+RoaringBitmap::Container RoaringBitmap::subtract(const Container& a, const Container& b) {
+    Container result;
+    result.key = a.key;
+    if (a.isBitmap()) {
+        result.words = a.words;
+        if (b.isBitmap()) {
+            for (std::size_t i = 0; i < WORDS; ++i) {
+                result.words[i] &= ~b.words[i];
+            }
+        } else {
+            for (uint16_t low : b.values) {
+                result.words[low >> 6] &= ~(uint64_t(1) << (low & 63));
+            }
+        }
+        result.cardinality = countBits(result.words.data(), WORDS);
+    } else if (b.isBitmap()) {
+        result.values.reserve(a.values.size());
+        for (uint16_t low : a.values) {
+            if (!(b.words[low >> 6] & (uint64_t(1) << (low & 63)))) {
+                result.values.push_back(low);
+            }
+        }
+        result.cardinality = static_cast<uint32_t>(result.values.size());
+    } else {
+        std::set_difference(a.values.begin(), a.values.end(), b.values.begin(), b.values.end(),
+                            std::back_inserter(result.values));
+        result.cardinality = static_cast<uint32_t>(result.values.size());
+    }
+    normalize(result);
+    return result;
+}
+
+/**
+ * @brief Find the container for a key
+ * @param key Upper 16 bits of a value
+ * @return Pointer to the container, nullptr if there is none
+ * @details Checks the last container first, which is where ascending
+ *          insertions go
+ */
+RoaringBitmap::Container* RoaringBitmap::findContainer(uint16_t key) {
+    if (!containers.empty() && containers.back().key == key) {
+        return &containers.back();
+    }
+    auto it = std::lower_bound(containers.begin(), containers.end(), key,
+                               [](const Container& container, uint16_t k) { return container.key < k; });
+    return it != containers.end() && it->key == key ? &*it : nullptr;
+}
+
+/**
+ * @brief Find the container for a key
+ * @param key Upper 16 bits of a value
+ * @return Pointer to the container, nullptr if there is none
+ */
+const RoaringBitmap::Container* RoaringBitmap::findContainer(uint16_t key) const {
+    return const_cast<RoaringBitmap*>(this)->findContainer(key);
+}
+
+/**
+ * @brief Add a value
+ * @param value Value to add
+ * @return true if the value was added, false if it was already present
+ */
+bool RoaringBitmap::add(uint32_t value) {
+    const uint16_t key = static_cast<uint16_t>(value >> 16);
+    const uint16_t low = static_cast<uint16_t>(value & 0xFFFF);
+
+    Container* container = findContainer(key);
+    if (!container) {
+        auto it = std::lower_bound(containers.begin(), containers.end(), key,
+                                   [](const Container& c, uint16_t k) { return c.key < k; });
+        container = &*containers.insert(it, Container());
+        container->key = key;
+    }
+
+    if (container->isBitmap()) {
+        uint64_t& word = container->words[low >> 6];
+        const uint64_t bit = uint64_t(1) << (low & 63);
+        if (word & bit) {
+            return false;
+        }
+        word |= bit;
+    } else {
+        std::vector<uint16_t>& values = container->values;
+        if (values.empty() || values.back() < low) {
+            values.push_back(low);
+        } else {
+            auto it = std::lower_bound(values.begin(), values.end(), low);
+            if (*it == low) {
+                return false;
+            }
+            values.insert(it, low);
+        }
+    }
+    ++container->cardinality;
+    ++total;
+    normalize(*container);
+    return true;
+}
+
+/**
+ * @brief Remove a value
+ * @param value Value to remove
+ * @return true if the value was removed, false if it was not present
+ */
+bool RoaringBitmap::remove(uint32_t value) {
+    const uint16_t key = static_cast<uint16_t>(value >> 16);
+    const uint16_t low = static_cast<uint16_t>(value & 0xFFFF);
+
+    Container* container = findContainer(key);
+    if (!container) {
+        return false;
+    }
+    if (container->isBitmap()) {
+        uint64_t& word = container->words[low >> 6];
+        const uint64_t bit = uint64_t(1) << (low & 63);
+        if (!(word & bit)) {
+            return false;
+        }
+        word &= ~bit;
+    } else {
+        std::vector<uint16_t>& values = container->values;
+        auto it = std::lower_bound(values.begin(), values.end(), low);
+        if (it == values.end() || *it != low) {
+            return false;
+        }
+        values.erase(it);
+    }
+    --container->cardinality;
+    --total;
+    if (container->cardinality == 0) {
+        containers.erase(containers.begin() + (container - containers.data()));
+    } else {
+        normalize(*container);
+    }
+    return true;
+}
+
+/**
+ * @brief Check whether a value is present
+ * @param value Value to look for
+ * @return true if the set contains the value
+ */
+bool RoaringBitmap::contains(uint32_t value) const {
+    const Container* container = findContainer(static_cast<uint16_t>(value >> 16));
+    if (!container) {
+        return false;
+    }
+    const uint16_t low = static_cast<uint16_t>(value & 0xFFFF);
+    if (container->isBitmap()) {
+        return container->words[low >> 6] & (uint64_t(1) << (low & 63));
+    }
+    return std::binary_search(container->values.begin(), container->values.end(), low);
+}
+
+/**
+ * @brief Get the number of values
+ * @return Set size
+ */
+uint64_t RoaringBitmap::cardinality() const {
+    return total;
+}
+
+/**
+ * @brief Check whether the set is empty
+ * @return true if there are no values
+ */
+bool RoaringBitmap::empty() const {
+    return total == 0;
+}
+
+/**
+ * @brief Remove every value
+ */
+void RoaringBitmap::clear() {
+    containers.clear();
+    total = 0;
+}
+
+/**
+ * @brief Get the values
+ * @return Values in ascending order
+ */
+std::vector<uint32_t> RoaringBitmap::toVector() const {
+    std::vector<uint32_t> result;
+    result.reserve(total);
+    forEach([&result](uint32_t value) { result.push_back(value); });
+    return result;
+}
+
+/**
+ * @brief Keep only the values that are also in another set
+ * @param other Set to intersect with
+ * @return This set
+ * @details Only containers whose key appears in both sets are combined
+ */
+RoaringBitmap& RoaringBitmap::operator&=(const RoaringBitmap& other) {
+    std::vector<Container> result;
+    uint64_t count = 0;
+    auto a = containers.begin();
+    auto b = other.containers.begin();
+    while (a != containers.end() && b != other.containers.end()) {
+        if (a->key < b->key) {
+            ++a;
+        } else if (b->key < a->key) {
+            ++b;
+        } else {
+            Container merged = intersect(*a, *b);
+            if (merged.cardinality > 0) {
+                count += merged.cardinality;
+                result.push_back(std::move(merged));
+            }
+            ++a;
+            ++b;
+        }
+    }
+    containers = std::move(result);
+    total = count;
+    return *this;
+}
+
+/**
+ * @brief Add every value of another set
+ * @param other Set to unite with
+ * @return This set
+ */
+RoaringBitmap& RoaringBitmap::operator|=(const RoaringBitmap& other) {
+    std::vector<Container> result;
+    result.reserve(containers.size() + other.containers.size());
+    uint64_t count = 0;
+    auto a = containers.begin();
+    auto b = other.containers.begin();
+    while (a != containers.end() || b != other.containers.end()) {
+        if (b == other.containers.end() || (a != containers.end() && a->key < b->key)) {
+            result.push_back(std::move(*a++));
+        } else if (a == containers.end() || b->key < a->key) {
+            result.push_back(*b++);
+        } else {
+            unite(*a, *b++);
+            result.push_back(std::move(*a++));
+        }
+        count += result.back().cardinality;
+    }
+    containers = std::move(result);
+    total = count;
+    return *this;
+}
+
+/**
+ * @brief Remove every value of another set
+ * @param other Set whose values are removed
+ * @return This set
+ */
+RoaringBitmap& RoaringBitmap::operator-=(const RoaringBitmap& other) {
+    std::vector<Container> result;
+    result.reserve(containers.size());
+    uint64_t count = 0;
+    auto b = other.containers.begin();
+    for (auto& container : containers) {
+        while (b != other.containers.end() && b->key < container.key) {
+            ++b;
+        }
+        if (b != other.containers.end() && b->key == container.key) {
+            Container remaining = subtract(container, *b);
+            if (remaining.cardinality == 0) {
+                continue;
+            }
+            result.push_back(std::move(remaining));
+        } else {
+            result.push_back(std::move(container));
+        }
+        count += result.back().cardinality;
+    }
+    containers = std::move(result);
+    total = count;
+    return *this;
+}
+
+/**
+ * @brief Compare two sets
+ * @param other Set to compare with
+ * @return true if both contain the same values
+ * @details Containers are always normalized, so equal sets have equal
+ *          representations
+ */
+bool RoaringBitmap::operator==(const RoaringBitmap& other) const {
+    if (total != other.total || containers.size() != other.containers.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < containers.size(); ++i) {
+        const Container& a = containers[i];
+        const Container& b = other.containers[i];
+        if (a.key != b.key || a.cardinality != b.cardinality || a.values != b.values || a.words != b.words) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,252 @@
+#include "RosterGenerator.h"
+#include "FileManager.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+/**
+ * @brief SplitMix64 random number generator
+ * @details Small, fast and seedable from any 64-bit value, which makes it a
+ *          good fit for one short stream per student
+ */
+class SplitMix64 {
+private:
+    uint64_t state;
+
+public:
+    explicit SplitMix64(uint64_t seed) : state(seed) {}
+
+    uint64_t next() {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    /// Uniform integer in [low, high]
+    uint64_t between(uint64_t low, uint64_t high) {
+        return low + next() % (high - low + 1);
+    }
+
+    /// Uniform double in [0, 1)
+    double unit() {
+        return static_cast<double>(next() >> 11) * 0x1.0p-53;
+    }
+};
+
+const char CONSONANTS[] = "bcdfghjklmnprstvwz";
+const char VOWELS[] = "aeiou";
+
+/**
+ * @brief Make a pronounceable capitalized name of a given length
+ * @param random Random stream to draw letters from
+ * @param length Number of characters
+ * @return The name
+ */
+std::string makeNamePart(SplitMix64& random, uint64_t length) {
+    std::string part;
+    part.reserve(length);
+    bool vowel = random.next() & 1;
+    for (uint64_t i = 0; i < length; ++i) {
+        part += vowel ? VOWELS[random.next() % (sizeof(VOWELS) - 1)]
+                      : CONSONANTS[random.next() % (sizeof(CONSONANTS) - 1)];
+        vowel = !vowel;
+    }
+    part[0] = static_cast<char>(part[0] - 'a' + 'A');
+    return part;
+}
+
+} // namespace
+
+/**
+ * @brief Constructor
+ * @param options Shape of the roster
+ * @throws std::invalid_argument if a range is empty or out of bounds
+ */
+RosterGenerator::RosterGenerator(const RosterOptions& options) : options(options) {
+    if (options.minNameLength < 5 || options.minNameLength > options.maxNameLength) {
+        throw std::invalid_argument("name lengths must satisfy 5 <= min <= max");
+    }
+    if (options.courseCatalogSize == 0 || options.minCourses > options.maxCourses ||
+        options.maxCourses > options.courseCatalogSize) {
+        throw std::invalid_argument("course counts must satisfy min <= max <= catalogue size");
+    }
+    if (options.minAge < 0 || options.minAge > options.maxAge || options.maxAge > 255) {
+        throw std::invalid_argument("ages must satisfy 0 <= min <= max <= 255");
+    }
+    if (!(options.courseZipfExponent >= 0)) {
+        throw std::invalid_argument("the Zipf exponent must not be negative");
+    }
+    if (options.records > 0 && options.firstId + (options.records - 1) > static_cast<uint64_t>(INT32_MAX)) {
+        throw std::invalid_argument("student IDs must fit in an int");
+    }
+
+    courseNames.reserve(options.courseCatalogSize);
+    courseCdf.reserve(options.courseCatalogSize);
+    double total = 0;
+    for (uint32_t rank = 0; rank < options.courseCatalogSize; ++rank) {
+        courseNames.push_back("COURSE" + std::to_string(rank));
+        total += 1.0 / std::pow(rank + 1.0, options.courseZipfExponent);
+        courseCdf.push_back(total);
+    }
+    for (double& cumulative : courseCdf) {
+        cumulative /= total;
+    }
+}
+
+/**
+ * @brief Get the options the roster is generated with
+ * @return The options
+ */
+const RosterOptions& RosterGenerator::getOptions() const {
+    return options;
+}
+
+/**
+ * @brief Get the name of a course
+ * @param rank Popularity rank, 0 is the most popular course
+ * @return Course name
+ */
+const std::string& RosterGenerator::getCourseName(uint32_t rank) const {
+    return courseNames.at(rank);
+}
+
+/**
+ * @brief Generate one student
+ * @param index Position of the student in the roster
+ * @return Student with ID options.firstId + index
+ * @details Courses are drawn by popularity until the student has enough
+ *          distinct ones. With a strong skew and many courses per student
+ *          the draws keep hitting the same popular courses, so after a
+ *          bounded number of attempts the rest are taken in rank order.
+ */
+Student RosterGenerator::makeStudent(uint64_t index) const {
+    SplitMix64 random(SplitMix64(options.seed).next() ^ (index * 0xD1342543DE82EF95ULL));
+    uint32_t id = options.firstId + static_cast<uint32_t>(index);
+
+    uint64_t nameLength = random.between(options.minNameLength, options.maxNameLength);
+    uint64_t firstLength = random.between(2, nameLength - 3);
+    std::string first = makeNamePart(random, firstLength);
+    std::string last = makeNamePart(random, nameLength - 1 - firstLength);
+
+    std::string email = first + "." + last + std::to_string(id) + "@example.com";
+    std::transform(email.begin(), email.end(), email.begin(), ::tolower);
+    int age = static_cast<int>(random.between(static_cast<uint64_t>(options.minAge),
+                                              static_cast<uint64_t>(options.maxAge)));
+
+    Student student(static_cast<int>(id), first + " " + last, email, age);
+
+    uint64_t courseCount = random.between(options.minCourses, options.maxCourses);
+    std::vector<uint32_t> ranks;
+    ranks.reserve(courseCount);
+    for (uint64_t attempt = 0; ranks.size() < courseCount && attempt < 16 * courseCount; ++attempt) {
+        uint32_t rank = static_cast<uint32_t>(
+            std::upper_bound(courseCdf.begin(), courseCdf.end(), random.unit()) - courseCdf.begin());
+        rank = std::min<uint32_t>(rank, options.courseCatalogSize - 1);
+        if (std::find(ranks.begin(), ranks.end(), rank) == ranks.end()) {
+            ranks.push_back(rank);
+        }
+    }
+    for (uint32_t rank = 0; ranks.size() < courseCount; ++rank) {
+        if (std::find(ranks.begin(), ranks.end(), rank) == ranks.end()) {
+            ranks.push_back(rank);
+        }
+    }
+    for (uint32_t rank : ranks) {
+        student.addCourse(courseNames[rank]);
+    }
+    return student;
+}
+
+/**
+ * @brief Generate the whole roster in memory
+ * @return All options.records students, in ID order
+ */
+std::vector<Student> RosterGenerator::makeStudents() const {
+    std::vector<Student> students;
+    students.reserve(options.records);
+    for (uint64_t index = 0; index < options.records; ++index) {
+        students.push_back(makeStudent(index));
+    }
+    return students;
+}
+
+/**
+ * @brief Write the roster as a CSV data file
+ * @param path Path of the file to write
+ * @param threads Number of threads generating records
+ * @return true if the file was written, false otherwise
+ * @details Each thread claims the next block, formats it into its own buffer
+ *          and then waits until the blocks before it are written. At most
+ *          one formatted block per thread is held in memory.
+ */
+bool RosterGenerator::writeFile(const std::string& path, unsigned threads) const {
+    const std::string tempPath = path + ".tmp";
+    std::ofstream outFile(tempPath, std::ios::binary | std::ios::trunc);
+    if (!outFile.is_open()) {
+        std::cerr << "Error: Unable to open file for writing: " << path << std::endl;
+        return false;
+    }
+
+    const uint64_t blockCount = (options.records + RECORDS_PER_BLOCK - 1) / RECORDS_PER_BLOCK;
+    std::atomic<uint64_t> nextBlock(0);
+    std::mutex mutex;
+    std::condition_variable turnChanged;
+    uint64_t turn = 0;  // Next block to append, guarded by mutex
+
+    auto generateBlocks = [&]() {
+        std::ostringstream buffer;
+        for (uint64_t block = nextBlock++; block < blockCount; block = nextBlock++) {
+            buffer.str(std::string());
+            uint64_t end = std::min(options.records, (block + 1) * RECORDS_PER_BLOCK);
+            for (uint64_t index = block * RECORDS_PER_BLOCK; index < end; ++index) {
+                FileManager::writeCsvRecord(buffer, makeStudent(index));
+            }
+            const std::string text = buffer.str();
+
+            std::unique_lock<std::mutex> lock(mutex);
+            turnChanged.wait(lock, [&turn, block] { return turn == block; });
+            outFile.write(text.data(), static_cast<std::streamsize>(text.size()));
+            ++turn;
+            turnChanged.notify_all();
+        }
+    };
+
+    uint64_t workerCount = std::min<uint64_t>(std::max(threads, 1u), std::max<uint64_t>(blockCount, 1));
+    std::vector<std::thread> workers;
+    for (uint64_t i = 1; i < workerCount; ++i) {
+        workers.emplace_back(generateBlocks);
+    }
+    generateBlocks();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    outFile.close();
+    if (outFile.fail()) {
+        std::cerr << "Error: Unable to write file: " << path << std::endl;
+        std::remove(tempPath.c_str());
+        return false;
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempPath, path, error);
+    if (error) {
+        std::cerr << "Error: Unable to replace file: " << path << std::endl;
+        std::remove(tempPath.c_str());
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,379 @@
+#include "ShardedStudentManager.h"
+#include "TrigramIndex.h"
+#include <algorithm>
+#include <iterator>
+#include <thread>
+#include <utility>
+
+namespace {
+
+/**
+ * @brief Order students by ID
+ */
+bool lessById(const Student* a, const Student* b) {
+    return a->getStudentId() < b->getStudentId();
+}
+
+/**
+ * @brief Order student copies by ID
+ */
+bool lessByIdValue(const Student& a, const Student& b) {
+    return a.getStudentId() < b.getStudentId();
+}
+
+} // namespace
+
+/**
+ * @brief Constructor
+ * @param shardCount Number of shards; 0 picks one per hardware thread
+ */
+ShardedStudentManager::ShardedStudentManager(size_t shardCount) : nextStudentId(1000) {
+    if (shardCount == 0) {
+        shardCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    shards.reserve(shardCount);
+    for (size_t i = 0; i < shardCount; ++i) {
+        shards.push_back(std::make_unique<StudentManager>(static_cast<uint32_t>(shardCount)));
+    }
+}
+
+/**
+ * @brief Get the shard holding an ID
+ * @param studentId Student ID
+ * @return The shard
+ */
+StudentManager& ShardedStudentManager::shardFor(uint32_t studentId) {
+    return *shards[studentId % shards.size()];
+}
+
+const StudentManager& ShardedStudentManager::shardFor(uint32_t studentId) const {
+    return *shards[studentId % shards.size()];
+}
+
+/**
+ * @brief Get the number of shards
+ * @return Shard count
+ */
+size_t ShardedStudentManager::getShardCount() const {
+    return shards.size();
+}
+
+/**
+ * @brief Add a new student to the management system
+ * @param name Student's name
+ * @param email Student's email
+ * @param age Student's age
+ * @return true if student was added successfully
+ * @details Takes the next ID from the shared counter and stores the student
+ *          in its shard under that ID
+ */
+bool ShardedStudentManager::addStudent(const std::string& name, const std::string& email, uint8_t age) {
+    uint32_t studentId = nextStudentId.fetch_add(1);
+    std::vector<Student> batch;
+    batch.emplace_back(studentId, name, email, age);
+    return shardFor(studentId).bulkLoadStudents(std::move(batch)) == 1;
+}
+
+/**
+ * @brief Add a batch of existing students, keeping their IDs
+ * @param loaded Students to take over; the vector is left empty
+ * @return Number of students stored
+ */
+uint32_t ShardedStudentManager::bulkLoadStudents(std::vector<Student>&& loaded) {
+    std::vector<std::vector<Student>> parts(shards.size());
+    uint32_t largestId = 0;
+    for (auto& student : loaded) {
+        uint32_t studentId = static_cast<uint32_t>(student.getStudentId());
+        largestId = std::max(largestId, studentId);
+        parts[studentId % shards.size()].push_back(std::move(student));
+    }
+    loaded.clear();
+
+    uint32_t count = 0;
+    for (size_t i = 0; i < shards.size(); ++i) {
+        count += shards[i]->bulkLoadStudents(std::move(parts[i]));
+    }
+
+    // Move the counter past the batch unless other adds already did
+    uint32_t next = nextStudentId.load();
+    while (next <= largestId && !nextStudentId.compare_exchange_weak(next, largestId + 1)) {
+    }
+    return count;
+}
+
+/**
+ * @brief Remove a student from the management system
+ * @param studentId ID of the student to remove
+ * @return true if student was found and removed, false otherwise
+ */
+bool ShardedStudentManager::deleteStudent(uint32_t studentId) {
+    return shardFor(studentId).deleteStudent(studentId);
+}
+
+/**
+ * @brief Retrieve a student by ID
+ * @param studentId ID of the student to find
+ * @return Pointer to the Student object if found, nullptr otherwise
+ */
+Student* ShardedStudentManager::getStudent(uint32_t studentId) {
+    return shardFor(studentId).getStudent(studentId);
+}
+
+/**
+ * @brief Retrieve a copy of a student
+ * @param studentId ID of the student to find
+ * @return The Student, or std::nullopt if there is none
+ */
+std::optional<Student> ShardedStudentManager::findStudent(uint32_t studentId) const {
+    return shardFor(studentId).findStudent(studentId);
+}
+
+/**
+ * @brief Search every shard for students by name
+ * @param name Full or partial name to search for
+ * @return Vector of pointers to matching Student objects, in ID order
+ */
+std::vector<Student*> ShardedStudentManager::searchStudentsByName(const std::string& name) {
+    std::vector<Student*> result;
+    for (auto& shard : shards) {
+        std::vector<Student*> found = shard->searchStudentsByName(name);
+        result.insert(result.end(), found.begin(), found.end());
+    }
+    std::sort(result.begin(), result.end(), lessById);
+    return result;
+}
+
+/**
+ * @brief Search every shard for students by name, returning copies
+ * @param name Full or partial name to search for
+ * @return Copies of the matching students, in ID order
+ */
+std::vector<Student> ShardedStudentManager::findStudentsByName(const std::string& name) const {
+    std::vector<Student> result;
+    for (const auto& shard : shards) {
+        std::vector<Student> found = shard->findStudentsByName(name);
+        std::move(found.begin(), found.end(), std::back_inserter(result));
+    }
+    std::sort(result.begin(), result.end(), lessByIdValue);
+    return result;
+}
+
+/**
+ * @brief Search every shard for students whose name starts with a prefix
+ * @param prefix Beginning of the name, compared case-insensitively
+ * @param limit Maximum number of students to return
+ * @return At most limit students, ordered by case-folded name and then by ID
+ */
+std::vector<Student*> ShardedStudentManager::searchStudentsByNamePrefix(const std::string& prefix,
+                                                                        size_t limit) {
+    std::vector<std::pair<std::string, Student*>> keyed;
+    for (auto& shard : shards) {
+        for (Student* student : shard->searchStudentsByNamePrefix(prefix, limit)) {
+            keyed.emplace_back(TrigramIndex::fold(student->getName()), student);
+        }
+    }
+    std::sort(keyed.begin(), keyed.end(), [](const auto& a, const auto& b) {
+        if (a.first != b.first) {
+            return a.first < b.first;
+        }
+        return a.second->getStudentId() < b.second->getStudentId();
+    });
+
+    std::vector<Student*> result;
+    for (size_t i = 0; i < keyed.size() && i < limit; ++i) {
+        result.push_back(keyed[i].second);
+    }
+    return result;
+}
+
+/**
+ * @brief Enroll a student in a course
+ * @param studentId ID of the student to enroll
+ * @param course Name of the course
+ * @return true if enrollment was successful, false otherwise
+ */
+bool ShardedStudentManager::enrollStudentInCourse(uint32_t studentId, const std::string& course) {
+    return shardFor(studentId).enrollStudentInCourse(studentId, course);
+}
+
+/**
+ * @brief Remove a student from a course
+ * @param studentId ID of the student
+ * @param course Name of the course
+ * @return true if removal was successful, false otherwise
+ */
+bool ShardedStudentManager::removeStudentFromCourse(uint32_t studentId, const std::string& course) {
+    return shardFor(studentId).removeStudentFromCourse(studentId, course);
+}
+
+/**
+ * @brief List the students enrolled in a course across all shards
+ * @param course Name of the course
+ * @return Pointers to the enrolled students, in ID order
+ */
+std::vector<Student*> ShardedStudentManager::getStudentsInCourse(const std::string& course) {
+    std::vector<Student*> result;
+    for (auto& shard : shards) {
+        std::vector<Student*> found = shard->getStudentsInCourse(course);
+        result.insert(result.end(), found.begin(), found.end());
+    }
+    std::sort(result.begin(), result.end(), lessById);
+    return result;
+}
+
+/**
+ * @brief Count the students enrolled in a course across all shards
+ * @param course Name of the course
+ * @return Number of enrolled students
+ */
+size_t ShardedStudentManager::getCourseEnrollmentCount(const std::string& course) const {
+    size_t count = 0;
+    for (const auto& shard : shards) {
+        count += shard->getCourseEnrollmentCount(course);
+    }
+    return count;
+}
+
+/**
+ * @brief Find the students matching a course query across all shards
+ * @param query Courses to combine
+ * @return Matching IDs in ascending order
+ */
+std::vector<uint32_t> ShardedStudentManager::findStudentIdsByCourses(const CourseQuery& query) const {
+    std::vector<uint32_t> result;
+    for (const auto& shard : shards) {
+        std::vector<uint32_t> found = shard->findStudentIdsByCourses(query);
+        result.insert(result.end(), found.begin(), found.end());
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+/**
+ * @brief Count the students matching a course query across all shards
+ * @param query Courses to combine
+ * @return Number of matching students
+ */
+size_t ShardedStudentManager::countStudentsByCourses(const CourseQuery& query) const {
+    size_t count = 0;
+    for (const auto& shard : shards) {
+        count += shard->countStudentsByCourses(query);
+    }
+    return count;
+}
+
+/**
+ * @brief Get the total number of students
+ * @return Sum of the shard counts
+ */
+uint32_t ShardedStudentManager::getStudentCount() const {
+    uint32_t count = 0;
+    for (const auto& shard : shards) {
+        count += shard->getStudentCount();
+    }
+    return count;
+}
+
+/**
+ * @brief Get the course intern table shared by all students
+ * @return The process-wide CourseDictionary
+ */
+CourseDictionary& ShardedStudentManager::getCourseDictionary() {
+    return StudentManager::getCourseDictionary();
+}
+
+/**
+ * @brief Get copies of all students
+ * @return Every student, in ID order
+ */
+std::vector<Student> ShardedStudentManager::getAllStudents() const {
+    std::vector<Student> result;
+    for (const auto& shard : shards) {
+        std::vector<Student> part = shard->getAllStudents();
+        std::move(part.begin(), part.end(), std::back_inserter(result));
+    }
+    std::sort(result.begin(), result.end(), lessByIdValue);
+    return result;
+}
+
+/**
+ * @brief Turn multi-version snapshots on or off in every shard
+ * @param enabled true to maintain them, false to drop them
+ */
+void ShardedStudentManager::setSnapshotsEnabled(bool enabled) {
+    for (auto& shard : shards) {
+        shard->setSnapshotsEnabled(enabled);
+    }
+}
+
+/**
+ * @brief Check whether multi-version snapshots are maintained
+ * @return true if they are enabled
+ */
+bool ShardedStudentManager::isSnapshotsEnabled() const {
+    return shards.front()->isSnapshotsEnabled();
+}
+
+/**
+ * @brief Turn the columnar copy on or off in every shard
+ * @param enabled true to build and maintain it, false to drop it
+ */
+void ShardedStudentManager::setColumnarStoreEnabled(bool enabled) {
+    for (auto& shard : shards) {
+        shard->setColumnarStoreEnabled(enabled);
+    }
+}
+
+/**
+ * @brief Check whether the columnar copy is maintained
+ * @return true if it is enabled
+ */
+bool ShardedStudentManager::isColumnarStoreEnabled() const {
+    return shards.front()->isColumnarStoreEnabled();
+}
+
+/**
+ * @brief Find the students whose age lies in a range
+ * @param minAge Smallest age to include
+ * @param maxAge Largest age to include
+ * @return Matching IDs in ascending order
+ */
+std::vector<uint32_t> ShardedStudentManager::findStudentIdsByAgeRange(int minAge, int maxAge) const {
+    std::vector<uint32_t> result;
+    for (const auto& shard : shards) {
+        std::vector<uint32_t> found = shard->findStudentIdsByAgeRange(minAge, maxAge);
+        result.insert(result.end(), found.begin(), found.end());
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+/**
+ * @brief Count the students whose age lies in a range
+ * @param minAge Smallest age to include
+ * @param maxAge Largest age to include
+ * @return Number of matching students
+ */
+size_t ShardedStudentManager::countStudentsByAgeRange(int minAge, int maxAge) const {
+    size_t count = 0;
+    for (const auto& shard : shards) {
+        count += shard->countStudentsByAgeRange(minAge, maxAge);
+    }
+    return count;
+}
+
+/**
+ * @brief Find the students whose ID lies in a range
+ * @param firstId Smallest ID to include
+ * @param lastId Largest ID to include
+ * @return Matching IDs in ascending order
+ */
+std::vector<uint32_t> ShardedStudentManager::findStudentIdsByIdRange(uint32_t firstId, uint32_t lastId) const {
+    std::vector<uint32_t> result;
+    for (const auto& shard : shards) {
+        std::vector<uint32_t> found = shard->findStudentIdsByIdRange(firstId, lastId);
+        result.insert(result.end(), found.begin(), found.end());
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
@@ -0,0 +1,263 @@
+#include "Snapshot.h"
+#include "CourseDictionary.h"
+#include "FileSync.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <unordered_map>
+
+/**
+ * @brief Write students to a snapshot file
+ * @param filePath Destination path
+ * @param students Students to write, in any order
+ * @return true if the snapshot was written, false otherwise
+ * @details Sorts pointers to the students by ID and writes those
+ */
+bool writeSnapshot(const std::string& filePath, const std::vector<Student>& students) {
+    std::vector<const Student*> ordered;
+    ordered.reserve(students.size());
+    for (const auto& student : students) {
+        ordered.push_back(&student);
+    }
+    std::stable_sort(ordered.begin(), ordered.end(), [](const Student* a, const Student* b) {
+        return static_cast<uint32_t>(a->getStudentId()) < static_cast<uint32_t>(b->getStudentId());
+    });
+    return writeSortedSnapshot(filePath, ordered);
+}
+
+/**
+ * @brief Write students to a snapshot file
+ * @param filePath Destination path
+ * @param students Students to write, in ascending ID order
+ * @return true if the snapshot was written, false otherwise
+ * @details Records keep the ascending ID order so readers can binary
+ *          search them. Course names are stored once in the course table and every
+ *          enrollment is a 4-byte reference into it.
+ */
+bool writeSortedSnapshot(const std::string& filePath, const std::vector<const Student*>& students) {
+    std::vector<SnapshotRecord> records;
+    std::vector<SnapshotCourse> courseTable;
+    std::unordered_map<uint32_t, uint32_t> courseIndex;  // CourseDictionary ID -> courseTable entry
+    std::vector<uint32_t> courseRefs;
+    std::string stringTable;
+    records.reserve(students.size());
+
+    for (const Student* entry : students) {
+        const Student& student = *entry;
+        const std::string& name = student.getName();
+        const std::string& email = student.getEmail();
+
+        SnapshotRecord record{};
+        record.studentId = static_cast<uint32_t>(student.getStudentId());
+        record.age = student.getAge();
+        record.nameOffset = stringTable.size();
+        record.nameLength = static_cast<uint32_t>(name.size());
+        stringTable += name;
+        record.emailOffset = stringTable.size();
+        record.emailLength = static_cast<uint32_t>(email.size());
+        stringTable += email;
+
+        record.firstCourseRef = courseRefs.size();
+        for (uint32_t courseId : student.getCourseIds()) {
+            auto inserted = courseIndex.emplace(courseId, static_cast<uint32_t>(courseTable.size()));
+            if (inserted.second) {
+                const std::string& course = CourseDictionary::instance().name(courseId);
+                SnapshotCourse entry{};
+                entry.offset = stringTable.size();
+                entry.length = static_cast<uint32_t>(course.size());
+                stringTable += course;
+                courseTable.push_back(entry);
+            }
+            courseRefs.push_back(inserted.first->second);
+        }
+        record.courseCount = static_cast<uint32_t>(courseRefs.size() - record.firstCourseRef);
+        records.push_back(record);
+    }
+
+    SnapshotHeader header{};
+    std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = SNAPSHOT_VERSION;
+    header.headerSize = sizeof(SnapshotHeader);
+    header.recordCount = records.size();
+    header.recordOffset = sizeof(SnapshotHeader);
+    header.courseCount = courseTable.size();
+    header.courseTableOffset = header.recordOffset + records.size() * sizeof(SnapshotRecord);
+    header.courseRefCount = courseRefs.size();
+    header.courseRefOffset = header.courseTableOffset + courseTable.size() * sizeof(SnapshotCourse);
+    header.stringTableOffset = header.courseRefOffset + courseRefs.size() * sizeof(uint32_t);
+    header.stringTableSize = stringTable.size();
+
+    const std::string tempPath = filePath + ".tmp";
+    {
+        std::ofstream outFile(tempPath, std::ios::binary | std::ios::trunc);
+        if (!outFile.is_open()) {
+            return false;
+        }
+        outFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        outFile.write(reinterpret_cast<const char*>(records.data()),
+                      static_cast<std::streamsize>(records.size() * sizeof(SnapshotRecord)));
+        outFile.write(reinterpret_cast<const char*>(courseTable.data()),
+                      static_cast<std::streamsize>(courseTable.size() * sizeof(SnapshotCourse)));
+        outFile.write(reinterpret_cast<const char*>(courseRefs.data()),
+                      static_cast<std::streamsize>(courseRefs.size() * sizeof(uint32_t)));
+        outFile.write(stringTable.data(), static_cast<std::streamsize>(stringTable.size()));
+        outFile.close();
+        if (outFile.fail()) {
+            std::remove(tempPath.c_str());
+            return false;
+        }
+    }
+
+    // A checkpoint truncates the journal next, so the snapshot must be on disk first
+    return replaceFileDurably(tempPath, filePath);
+}
+
+/**
+ * @brief Default constructor
+ * @details Creates an empty, detached view
+ */
+SnapshotView::SnapshotView()
+    : records(nullptr), courses(nullptr),
+      courseRefs(nullptr), strings(nullptr), header{} {}
+
+/**
+ * @brief Attach the view to snapshot bytes
+ * @param bytes Start of the snapshot, must stay valid while the view is used
+ * @param size Number of bytes available
+ * @return true if the header and sections are valid, false otherwise
+ */
+bool SnapshotView::attach(const char* bytes, std::size_t size) {
+    *this = SnapshotView();
+    if (bytes == nullptr || size < sizeof(SnapshotHeader)) {
+        return false;
+    }
+
+    SnapshotHeader candidate;
+    std::memcpy(&candidate, bytes, sizeof(candidate));
+    if (std::memcmp(candidate.magic, SNAPSHOT_MAGIC, sizeof(candidate.magic)) != 0 ||
+        candidate.version != SNAPSHOT_VERSION || candidate.headerSize != sizeof(SnapshotHeader)) {
+        return false;
+    }
+
+    // Every section has to lie inside the file; counts are checked against
+    // the file size first so the multiplications cannot overflow
+    auto sectionFits = [size](uint64_t offset, uint64_t count, uint64_t elementSize) {
+        return offset <= size && count <= (size - offset) / elementSize;
+    };
+    if (!sectionFits(candidate.recordOffset, candidate.recordCount, sizeof(SnapshotRecord)) ||
+        !sectionFits(candidate.courseTableOffset, candidate.courseCount, sizeof(SnapshotCourse)) ||
+        !sectionFits(candidate.courseRefOffset, candidate.courseRefCount, sizeof(uint32_t)) ||
+        !sectionFits(candidate.stringTableOffset, candidate.stringTableSize, 1) ||
+        candidate.recordOffset % alignof(SnapshotRecord) != 0 ||
+        candidate.courseTableOffset % alignof(SnapshotCourse) != 0 ||
+        candidate.courseRefOffset % alignof(uint32_t) != 0) {
+        return false;
+    }
+
+    header = candidate;
+    records = reinterpret_cast<const SnapshotRecord*>(bytes + header.recordOffset);
+    courses = reinterpret_cast<const SnapshotCourse*>(bytes + header.courseTableOffset);
+    courseRefs = reinterpret_cast<const uint32_t*>(bytes + header.courseRefOffset);
+    strings = bytes + header.stringTableOffset;
+    return true;
+}
+
+/**
+ * @brief Get the number of student records
+ * @return Record count, 0 for a detached view
+ */
+std::size_t SnapshotView::size() const {
+    return static_cast<std::size_t>(header.recordCount);
+}
+
+/**
+ * @brief Get a raw record
+ * @param index Record index, less than size()
+ * @return Reference to the record inside the snapshot
+ */
+const SnapshotRecord& SnapshotView::record(std::size_t index) const {
+    return records[index];
+}
+
+/**
+ * @brief Get a bounds-checked slice of the string table
+ * @param offset Offset inside the string table
+ * @param length Length of the slice
+ * @return The slice
+ * @throws std::out_of_range if the slice leaves the string table
+ */
+std::string_view SnapshotView::stringAt(uint64_t offset, uint64_t length) const {
+    if (offset > header.stringTableSize || length > header.stringTableSize - offset) {
+        throw std::out_of_range("SnapshotView: string outside the string table");
+    }
+    return std::string_view(strings + offset, static_cast<std::size_t>(length));
+}
+
+/**
+ * @brief Get the name of a record
+ * @param index Record index, less than size()
+ * @return Name bytes inside the snapshot
+ */
+std::string_view SnapshotView::name(std::size_t index) const {
+    return stringAt(records[index].nameOffset, records[index].nameLength);
+}
+
+/**
+ * @brief Get the email of a record
+ * @param index Record index, less than size()
+ * @return Email bytes inside the snapshot
+ */
+std::string_view SnapshotView::email(std::size_t index) const {
+    return stringAt(records[index].emailOffset, records[index].emailLength);
+}
+
+/**
+ * @brief Get one course name of a record
+ * @param index Record index, less than size()
+ * @param course Course position, less than record(index).courseCount
+ * @return Course name bytes inside the snapshot
+ */
+std::string_view SnapshotView::course(std::size_t index, std::size_t course) const {
+    const SnapshotRecord& entry = records[index];
+    if (course >= entry.courseCount || entry.firstCourseRef > header.courseRefCount ||
+        course >= header.courseRefCount - entry.firstCourseRef) {
+        throw std::out_of_range("SnapshotView: course reference outside the reference array");
+    }
+    uint32_t courseIndex = courseRefs[entry.firstCourseRef + course];
+    if (courseIndex >= header.courseCount) {
+        throw std::out_of_range("SnapshotView: course index outside the course table");
+    }
+    return stringAt(courses[courseIndex].offset, courses[courseIndex].length);
+}
+
+/**
+ * @brief Find a record by student ID
+ * @param studentId ID to look for
+ * @return Index of the record, or size() if there is none
+ */
+std::size_t SnapshotView::find(uint32_t studentId) const {
+    const SnapshotRecord* end = records + size();
+    const SnapshotRecord* it = std::lower_bound(records, end, studentId,
+        [](const SnapshotRecord& record, uint32_t id) { return record.studentId < id; });
+    if (it != end && it->studentId == studentId) {
+        return static_cast<std::size_t>(it - records);
+    }
+    return size();
+}
+
+/**
+ * @brief Build a Student from a record
+ * @param index Record index, less than size()
+ * @return The materialized Student, including its courses
+ */
+Student SnapshotView::materialize(std::size_t index) const {
+    const SnapshotRecord& entry = records[index];
+    Student student(static_cast<int>(entry.studentId), std::string(name(index)),
+                    std::string(email(index)), entry.age);
+    for (std::size_t i = 0; i < entry.courseCount; ++i) {
+        student.addCourse(course(index, i));
+    }
+    return student;
+}
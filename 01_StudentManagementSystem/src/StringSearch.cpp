@@ -0,0 +1,203 @@
+#include "StringSearch.h"
+#include <cstddef>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__)) && \
+    defined(__SSE2__)
+#define SMS_STRING_SEARCH_X86 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+/**
+ * @brief ASCII lowercase of a single byte
+ */
+inline unsigned char foldCase(unsigned char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<unsigned char>(c | 0x20) : c;
+}
+
+/**
+ * @brief Compare two byte ranges ignoring ASCII case
+ */
+inline bool equalsIgnoreCase(const char* a, const char* b, size_t length) {
+    for (size_t i = 0; i < length; ++i) {
+        if (foldCase(static_cast<unsigned char>(a[i])) != foldCase(static_cast<unsigned char>(b[i]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Byte-at-a-time search over the positions [start, end of text]
+ */
+bool containsScalar(std::string_view text, std::string_view pattern, size_t start) {
+    const unsigned char first = foldCase(static_cast<unsigned char>(pattern[0]));
+    for (size_t position = start; position + pattern.size() <= text.size(); ++position) {
+        if (foldCase(static_cast<unsigned char>(text[position])) == first &&
+            equalsIgnoreCase(text.data() + position + 1, pattern.data() + 1, pattern.size() - 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+#ifdef SMS_STRING_SEARCH_X86
+
+/**
+ * @brief Lowercase the ASCII letters of 16 bytes
+ * @details Subtracting 'A' + 128 maps 'A'..'Z' to the 26 smallest signed
+ *          bytes, so one signed compare finds the upper-case letters
+ */
+inline __m128i fold16(__m128i bytes) {
+    __m128i shifted = _mm_sub_epi8(bytes, _mm_set1_epi8(static_cast<char>('A' + 128)));
+    __m128i isUpper = _mm_cmpgt_epi8(_mm_set1_epi8(static_cast<char>(-128 + 26)), shifted);
+    return _mm_or_si128(bytes, _mm_and_si128(isUpper, _mm_set1_epi8(0x20)));
+}
+
+/**
+ * @brief SSE2 search: 16 candidate positions per step
+ */
+bool containsSse2(std::string_view text, std::string_view pattern) {
+    const size_t last = pattern.size() - 1;
+    const __m128i firstByte = _mm_set1_epi8(static_cast<char>(foldCase(static_cast<unsigned char>(pattern[0]))));
+    const __m128i lastByte = _mm_set1_epi8(static_cast<char>(foldCase(static_cast<unsigned char>(pattern[last]))));
+    const char* data = text.data();
+
+    size_t position = 0;
+    for (; position + last + 16 <= text.size(); position += 16) {
+        __m128i blockFirst = fold16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position)));
+        __m128i blockLast = fold16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position + last)));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(firstByte, blockFirst), _mm_cmpeq_epi8(lastByte, blockLast))));
+        while (mask != 0) {
+            size_t candidate = position + static_cast<size_t>(__builtin_ctz(mask));
+            if (last < 2 || equalsIgnoreCase(data + candidate + 1, pattern.data() + 1, last - 1)) {
+                return true;
+            }
+            mask &= mask - 1;
+        }
+    }
+    return containsScalar(text, pattern, position);
+}
+
+/**
+ * @brief Lowercase the ASCII letters of 32 bytes
+ */
+__attribute__((target("avx2"))) inline __m256i fold32(__m256i bytes) {
+    __m256i shifted = _mm256_sub_epi8(bytes, _mm256_set1_epi8(static_cast<char>('A' + 128)));
+    __m256i isUpper = _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(-128 + 26)), shifted);
+    return _mm256_or_si256(bytes, _mm256_and_si256(isUpper, _mm256_set1_epi8(0x20)));
+}
+
+/**
+ * @brief AVX2 search: 32 candidate positions per step
+ */
+__attribute__((target("avx2"))) bool containsAvx2(std::string_view text, std::string_view pattern) {
+    const size_t last = pattern.size() - 1;
+    const __m256i firstByte = _mm256_set1_epi8(static_cast<char>(foldCase(static_cast<unsigned char>(pattern[0]))));
+    const __m256i lastByte = _mm256_set1_epi8(static_cast<char>(foldCase(static_cast<unsigned char>(pattern[last]))));
+    const char* data = text.data();
+
+    size_t position = 0;
+    for (; position + last + 32 <= text.size(); position += 32) {
+        __m256i blockFirst = fold32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + position)));
+        __m256i blockLast = fold32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + position + last)));
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(firstByte, blockFirst), _mm256_cmpeq_epi8(lastByte, blockLast))));
+        while (mask != 0) {
+            size_t candidate = position + static_cast<size_t>(__builtin_ctz(mask));
+            if (last < 2 || equalsIgnoreCase(data + candidate + 1, pattern.data() + 1, last - 1)) {
+                return true;
+            }
+            mask &= mask - 1;
+        }
+    }
+    // The remaining positions fit in SSE2 steps and a scalar tail
+    return containsSse2(text.substr(position), pattern);
+}
+
+#endif // SMS_STRING_SEARCH_X86
+
+/**
+ * @brief Pick the widest kernel the CPU supports
+ */
+StringSearchKernel detectKernel() {
+#ifdef SMS_STRING_SEARCH_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return StringSearchKernel::Avx2;
+    }
+    return StringSearchKernel::Sse2;
+#else
+    return StringSearchKernel::Scalar;
+#endif
+}
+
+} // namespace
+
+/**
+ * @brief Get the kernel containsIgnoreCase(text, pattern) uses on this CPU
+ * @return The fastest supported kernel
+ */
+StringSearchKernel activeStringSearchKernel() {
+    static const StringSearchKernel kernel = detectKernel();
+    return kernel;
+}
+
+/**
+ * @brief Check whether a kernel can run on this CPU
+ * @param kernel Kernel to check
+ * @return true if the kernel is compiled in and supported by the CPU
+ */
+bool isStringSearchKernelSupported(StringSearchKernel kernel) {
+    switch (kernel) {
+        case StringSearchKernel::Scalar:
+            return true;
+        case StringSearchKernel::Sse2:
+            return activeStringSearchKernel() != StringSearchKernel::Scalar;
+        case StringSearchKernel::Avx2:
+            return activeStringSearchKernel() == StringSearchKernel::Avx2;
+    }
+    return false;
+}
+
+/**
+ * @brief Check whether text contains pattern with a specific kernel
+ * @param text Text to search in
+ * @param pattern Text to search for
+ * @param kernel Kernel to use; an unsupported one falls back to the next narrower kernel
+ * @return true if pattern occurs in text
+ */
+bool containsIgnoreCase(std::string_view text, std::string_view pattern, StringSearchKernel kernel) {
+    if (pattern.empty()) {
+        return true;
+    }
+    if (pattern.size() > text.size()) {
+        return false;
+    }
+#ifdef SMS_STRING_SEARCH_X86
+    // Texts shorter than one AVX2 step skip it: the 256-bit setup costs more
+    // than it saves and mixing it with the SSE2 tail stalls on some CPUs
+    if (kernel == StringSearchKernel::Avx2 && text.size() >= pattern.size() + 31 &&
+        isStringSearchKernelSupported(kernel)) {
+        return containsAvx2(text, pattern);
+    }
+    if (kernel != StringSearchKernel::Scalar) {
+        return containsSse2(text, pattern);
+    }
+#else
+    (void)kernel;
+#endif
+    return containsScalar(text, pattern, 0);
+}
+
+/**
+ * @brief Check whether text contains pattern, ignoring ASCII case
+ * @param text Text to search in
+ * @param pattern Text to search for; an empty pattern matches everything
+ * @return true if pattern occurs in text
+ */
+bool containsIgnoreCase(std::string_view text, std::string_view pattern) {
+    return containsIgnoreCase(text, pattern, activeStringSearchKernel());
+}
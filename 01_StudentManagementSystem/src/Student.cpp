@@ -1,5 +1,8 @@
 #include "Student.h"
+#include "CourseDictionary.h"
+#include <algorithm>
 #include <sstream>
+#include <utility>
 
 /**
  * @brief Default constructor
@@ -8,7 +11,7 @@
  *          - ID set to 0
  *          - Empty name and email strings
  *          - Age set to 0
- *          - Empty courses vector
+ *          - No courses
  */
 Student::Student() : studentId(0), name(""), email(""), age(0) {}
 
@@ -19,8 +22,8 @@ Student::Student() : studentId(0), name(""), email(""), age(0) {}
  * @param email The student's email address
  * @param age The student's age
  */
-Student::Student(int id, const std::string& name, const std::string& email, int age)
-    : studentId(id), name(name), email(email), age(age) {}
+Student::Student(int id, std::string name, std::string email, int age)
+    : studentId(id), name(std::move(name)), email(std::move(email)), age(age) {}
 
 /**
  * @brief Get the student's ID
@@ -32,17 +35,17 @@ int Student::getStudentId() const {
 
 /**
  * @brief Get the student's name
- * @return The student's full name
+ * @return The student's full name, valid until the name is changed
  */
-std::string Student::getName() const {
+const std::string& Student::getName() const {
     return name;
 }
 
 /**
  * @brief Get the student's email
- * @return The student's email address
+ * @return The student's email address, valid until the email is changed
  */
-std::string Student::getEmail() const {
+const std::string& Student::getEmail() const {
     return email;
 }
 
@@ -57,11 +60,27 @@ int Student::getAge() const {
 /**
  * @brief Get the list of courses the student is enrolled in
  * @return Vector containing course names
+ * @details Names are looked up in the CourseDictionary on every call; code
+ *          that only compares courses should use getCourseIds()
  */
 std::vector<std::string> Student::getCourses() const {
+    const CourseDictionary& dictionary = CourseDictionary::instance();
+    std::vector<std::string> courses;
+    courses.reserve(courseIds.size());
+    for (uint32_t courseId : courseIds) {
+        courses.push_back(dictionary.name(courseId));
+    }
     return courses;
 }
 
+/**
+ * @brief Get the IDs of the enrolled courses
+ * @return CourseDictionary IDs in enrollment order
+ */
+const std::vector<uint32_t>& Student::getCourseIds() const {
+    return courseIds;
+}
+
 /**
  * @brief Set the student's ID
  * @param id New ID number to assign
@@ -97,24 +116,45 @@ void Student::setAge(int age) {
 /**
  * @brief Add a course to student's enrollment list
  * @param course Name of the course to add
+ * @details Adds a course only if the student is not already enrolled in it.
+ *          New course names are added to the CourseDictionary.
+ */
+void Student::addCourse(std::string_view course) {
+    addCourseId(CourseDictionary::instance().intern(course));
+}
+
+/**
+ * @brief Add a course to student's enrollment list by ID
+ * @param courseId CourseDictionary ID of the course to add
  * @details Adds a course only if the student is not already enrolled in it
  */
-void Student::addCourse(const std::string& course) {
-    if (!isEnrolledIn(course)) {
-        courses.push_back(course);
+void Student::addCourseId(uint32_t courseId) {
+    if (!isEnrolledInCourseId(courseId)) {
+        courseIds.push_back(courseId);
     }
 }
 
 /**
  * @brief Remove a course from student's enrollment list
  * @param course Name of the course to remove
+ * @details A name missing from the CourseDictionary cannot be enrolled, so
+ *          it is not added to the dictionary
  */
-void Student::removeCourse(const std::string& course) {
-    for (auto it = courses.begin(); it != courses.end(); ++it) {
-        if (*it == course) {
-            courses.erase(it);
-            break;
-        }
+void Student::removeCourse(std::string_view course) {
+    std::optional<uint32_t> courseId = CourseDictionary::instance().find(course);
+    if (courseId) {
+        removeCourseId(*courseId);
+    }
+}
+
+/**
+ * @brief Remove a course from student's enrollment list by ID
+ * @param courseId CourseDictionary ID of the course to remove
+ */
+void Student::removeCourseId(uint32_t courseId) {
+    auto it = std::find(courseIds.begin(), courseIds.end(), courseId);
+    if (it != courseIds.end()) {
+        courseIds.erase(it);
     }
 }
 
@@ -123,13 +163,21 @@ void Student::removeCourse(const std::string& course) {
  * @param course Name of the course to check
  * @return true if student is enrolled, false otherwise
  */
-bool Student::isEnrolledIn(const std::string& course) const {
-    for (const auto& c : courses) {
-        if (c == course) {
-            return true;
-        }
+bool Student::isEnrolledIn(std::string_view course) const {
+    if (courseIds.empty()) {
+        return false;
     }
-    return false;
+    std::optional<uint32_t> courseId = CourseDictionary::instance().find(course);
+    return courseId && isEnrolledInCourseId(*courseId);
+}
+
+/**
+ * @brief Check if student is enrolled in a course given by ID
+ * @param courseId CourseDictionary ID of the course to check
+ * @return true if student is enrolled, false otherwise
+ */
+bool Student::isEnrolledInCourseId(uint32_t courseId) const {
+    return std::find(courseIds.begin(), courseIds.end(), courseId) != courseIds.end();
 }
 
 /**
@@ -144,22 +192,34 @@ bool Student::isEnrolledIn(const std::string& course) const {
  */
 std::string Student::toString() const {
     std::stringstream ss;
-    ss << "Student ID: " << studentId << "\n"
-       << "Name: " << name << "\n"
-       << "Email: " << email << "\n"
-       << "Age: " << age << "\n"
-       << "Courses: ";
+    ss << *this;
+    return ss.str();
+}
+
+/**
+ * @brief Write student information in the toString() format
+ * @param out Stream to write to
+ * @param student Student to write
+ * @return The stream
+ * @details Writes straight to the stream, so listing many students does
+ *          not build a string per student
+ */
+std::ostream& operator<<(std::ostream& out, const Student& student) {
+    out << "Student ID: " << student.getStudentId() << "\n"
+        << "Name: " << student.getName() << "\n"
+        << "Email: " << student.getEmail() << "\n"
+        << "Age: " << student.getAge() << "\n"
+        << "Courses: ";
     
-    if (courses.empty()) {
-        ss << "None";
+    if (student.getCourseIds().empty()) {
+        out << "None";
     } else {
-        for (size_t i = 0; i < courses.size(); ++i) {
-            ss << courses[i];
-            if (i < courses.size() - 1) {
-                ss << ", ";
-            }
-        }
+        bool first = true;
+        student.forEachCourse([&](const std::string& course) {
+            out << (first ? "" : ", ") << course;
+            first = false;
+        });
     }
     
-    return ss.str();
+    return out;
 }
@@ -1,42 +1,145 @@
 #include "StudentManager.h"
+#include "Journal.h"
+#include "StringSearch.h"
+#include "Tracing.h"
 #include <algorithm>
+#include <mutex>
 
 /**
  * @brief Default constructor
  * @details Initializes the student management system with starting ID of 1000
  */
-StudentManager::StudentManager() : nextStudentId(1000) {}
+StudentManager::StudentManager() : StudentManager(1) {}
+
+/**
+ * @brief Constructor for a manager holding every idStride-th ID
+ * @param idStride Distance between the IDs this manager will hold
+ */
+StudentManager::StudentManager(uint32_t idStride)
+    : students(idStride), nextStudentId(1000), journal(nullptr) {}
 
 /**
  * @brief Add a new student to the management system
  * @param name Student's full name
  * @param email Student's email address
  * @param age Student's age
- * @return true if student was successfully added
+ * @return true if student was successfully added, false if the journal
+ *         commit required by the durability policy failed
  * @details Creates a new student with the next available ID and adds them to the system
  */
 bool StudentManager::addStudent(const std::string& name, const std::string& email, uint8_t age) {
+    SMS_METRICS_SCOPE(Operation::AddStudent);
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    
     // Create a new student with the next available ID
     Student newStudent(nextStudentId, name, email, age);
     
-    // Add the student to the map
-    students[nextStudentId] = newStudent;
+    // Add the student to the map and the name index
+    const Student& stored = students.insertOrAssign(nextStudentId, std::move(newStudent));
+    nameIndex.add(nextStudentId, stored.getName());
+    prefixIndex.add(nextStudentId, stored.getName());
+    if (columns) {
+        columns->upsert(stored);
+    }
+    if (versions) {
+        versions->upsert(stored);
+    }
     
     // Increment the next available ID
     nextStudentId++;
     
+    // Commit outside the lock so concurrent writers share journal syncs
+    if (journal) {
+        Journal* target = journal;
+        uint64_t sequence = journal->recordAddStudent(stored);
+        lock.unlock();
+        return target->commitPerPolicy(sequence);
+    }
+    
     return true;
 }
 
+/**
+ * @brief Add a batch of existing students, keeping their IDs
+ * @param loaded Students to take over; the vector is left empty
+ * @return Number of students stored
+ */
+uint32_t StudentManager::bulkLoadStudents(std::vector<Student>&& loaded) {
+    SMS_METRICS_SCOPE(Operation::BulkLoadStudents);
+    TraceSpan span("bulkLoadStudents");
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    auto byId = [](const Student& a, const Student& b) {
+        return static_cast<uint32_t>(a.getStudentId()) < static_cast<uint32_t>(b.getStudentId());
+    };
+    
+    // Saved files are already in ID order, so this is normally just a check
+    if (!std::is_sorted(loaded.begin(), loaded.end(), byId)) {
+        TraceSpan sortSpan("sortStudents");
+        std::stable_sort(loaded.begin(), loaded.end(), byId);
+    }
+    
+    // Indexing, course enrollment and the store insert run per student, so they share one span
+    TraceSpan insertSpan("insertStudents");
+    insertSpan.setArg("records", loaded.size());
+    for (auto& student : loaded) {
+        uint32_t id = static_cast<uint32_t>(student.getStudentId());
+        
+        // Only IDs below nextStudentId can already be present
+        if (id < nextStudentId) {
+            if (const Student* existing = students.find(id)) {
+                nameIndex.remove(id, existing->getName());
+                prefixIndex.remove(id, existing->getName());
+                courseIndex.removeStudent(id, existing->getCourseIds());
+            }
+        }
+        nameIndex.add(id, student.getName());
+        prefixIndex.add(id, student.getName());
+        courseIndex.addStudent(id, student.getCourseIds());
+        
+        const Student& stored = students.insertOrAssign(id, std::move(student));
+        if (columns) {
+            columns->upsert(stored);
+        }
+        if (versions) {
+            versions->upsert(stored);
+        }
+        
+        if (id >= nextStudentId) {
+            nextStudentId = id + 1;
+        }
+    }
+    
+    uint32_t count = static_cast<uint32_t>(loaded.size());
+    loaded.clear();
+    return count;
+}
+
 /**
  * @brief Remove a student from the management system
  * @param studentId ID of the student to remove
- * @return true if student was found and removed, false otherwise
+ * @return true if student was found and removed, false otherwise or if the
+ *         journal commit required by the durability policy failed
  */
 bool StudentManager::deleteStudent(uint32_t studentId) {
-    auto it = students.find(studentId);
-    if (it != students.end()) {
-        students.erase(it);
+    SMS_METRICS_SCOPE(Operation::DeleteStudent);
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    if (const Student* student = students.find(studentId)) {
+        nameIndex.remove(studentId, student->getName());
+        prefixIndex.remove(studentId, student->getName());
+        courseIndex.removeStudent(studentId, student->getCourseIds());
+        students.erase(studentId);
+        if (columns) {
+            columns->erase(studentId);
+        }
+        if (versions) {
+            versions->erase(studentId);
+        }
+        if (journal) {
+            Journal* target = journal;
+            uint64_t sequence = journal->recordDeleteStudent(studentId);
+            lock.unlock();
+            return target->commitPerPolicy(sequence);
+        }
         return true;
     }
     return false;
@@ -48,36 +151,116 @@ bool StudentManager::deleteStudent(uint32_t studentId) {
  * @return Pointer to the Student object if found, nullptr otherwise
  */
 Student* StudentManager::getStudent(uint32_t studentId) {
-    auto it = students.find(studentId);
-    if (it != students.end()) {
-        return &(it->second);
+    SMS_METRICS_SCOPE(Operation::GetStudent);
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return students.find(studentId);
+}
+
+/**
+ * @brief Retrieve a copy of a student
+ * @param studentId ID of the student to find
+ * @return The Student, or std::nullopt if there is none
+ */
+std::optional<Student> StudentManager::findStudent(uint32_t studentId) const {
+    SMS_METRICS_SCOPE(Operation::GetStudent);
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    if (const Student* student = students.find(studentId)) {
+        return *student;
     }
-    return nullptr;
+    return std::nullopt;
+}
+
+/**
+ * @brief Find the IDs of the students whose name contains a string
+ * @param name Full or partial name to search for
+ * @return Matching IDs in ascending order
+ * @details Performs a case-insensitive search of student names. Queries of
+ *          three or more characters only look at the students the trigram
+ *          index reports as candidates; shorter ones scan every student.
+ *          Candidates are checked with the SIMD containsIgnoreCase kernel.
+ *          The caller holds the lock.
+ */
+std::vector<uint32_t> StudentManager::matchStudentIdsByName(const std::string& name) const {
+    std::vector<uint32_t> result;
+    const std::string searchName = TrigramIndex::fold(name);
+    
+    if (TrigramIndex::canNarrow(searchName)) {
+        std::vector<uint32_t> candidates;
+        {
+            TraceSpan span("nameIndexCandidates");
+            candidates = nameIndex.candidates(searchName);
+            span.setArg("candidates", candidates.size());
+        }
+        TraceSpan span("verifyCandidates");
+        for (uint32_t id : candidates) {
+            const Student* student = students.find(id);
+            if (student && containsIgnoreCase(student->getName(), searchName)) {
+                result.push_back(id);
+            }
+        }
+        return result;
+    }
+    
+    TraceSpan span("scanNames");
+    students.forEach([&](const Student& student) {
+        if (containsIgnoreCase(student.getName(), searchName)) {
+            result.push_back(static_cast<uint32_t>(student.getStudentId()));
+        }
+    });
+    
+    return result;
 }
 
 /**
  * @brief Search for students by name
  * @param name Full or partial name to search for
- * @return Vector of pointers to matching Student objects
- * @details Performs a case-insensitive search of student names
+ * @return Vector of pointers to matching Student objects, in ID order
  */
 std::vector<Student*> StudentManager::searchStudentsByName(const std::string& name) {
+    SMS_METRICS_SCOPE(Operation::SearchStudents);
+    TraceSpan span("searchStudentsByName");
+    std::shared_lock<std::shared_mutex> lock(mutex);
     std::vector<Student*> result;
-    
-    for (auto& pair : students) {
-        // Case-insensitive search
-        std::string studentName = pair.second.getName();
-        std::string searchName = name;
-        
-        // Convert both strings to lowercase for case-insensitive comparison
-        std::transform(studentName.begin(), studentName.end(), studentName.begin(), ::tolower);
-        std::transform(searchName.begin(), searchName.end(), searchName.begin(), ::tolower);
-        
-        if (studentName.find(searchName) != std::string::npos) {
-            result.push_back(&pair.second);
+    for (uint32_t id : matchStudentIdsByName(name)) {
+        result.push_back(students.find(id));
+    }
+    span.setArg("matches", result.size());
+    return result;
+}
+
+/**
+ * @brief Search for students by name, returning copies
+ * @param name Full or partial name to search for
+ * @return Copies of the matching students, in ID order
+ */
+std::vector<Student> StudentManager::findStudentsByName(const std::string& name) const {
+    SMS_METRICS_SCOPE(Operation::SearchStudents);
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    std::vector<Student> result;
+    for (uint32_t id : matchStudentIdsByName(name)) {
+        result.push_back(*students.find(id));
+    }
+    return result;
+}
+
+/**
+ * @brief Search for students whose name starts with a prefix
+ * @param prefix Beginning of the name, compared case-insensitively
+ * @param limit Maximum number of students to return
+ * @return Vector of pointers to matching Student objects, ordered by name
+ * @details Backed by the sorted name index: one seek plus one step per
+ *          returned student, however many students share the prefix.
+ */
+std::vector<Student*> StudentManager::searchStudentsByNamePrefix(const std::string& prefix,
+                                                                 size_t limit) {
+    SMS_METRICS_SCOPE(Operation::SearchStudents);
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    std::vector<Student*> result;
+    for (uint32_t id : prefixIndex.find(TrigramIndex::fold(prefix), limit)) {
+        if (Student* student = students.find(id)) {
+            result.push_back(student);
         }
     }
-    
     return result;
 }
 
@@ -85,12 +268,29 @@ std::vector<Student*> StudentManager::searchStudentsByName(const std::string& na
  * @brief Enroll a student in a course
  * @param studentId ID of the student to enroll
  * @param course Name of the course
- * @return true if student was found and enrolled, false otherwise
+ * @return true if student was found and enrolled, false otherwise or if the
+ *         journal commit required by the durability policy failed
  */
 bool StudentManager::enrollStudentInCourse(uint32_t studentId, const std::string& course) {
-    Student* student = getStudent(studentId);
+    SMS_METRICS_SCOPE(Operation::EnrollInCourse);
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    Student* student = students.find(studentId);
     if (student) {
-        student->addCourse(course);
+        uint32_t courseId = CourseDictionary::instance().intern(course);
+        student->addCourseId(courseId);
+        courseIndex.add(courseId, studentId);
+        if (columns) {
+            columns->updateCourses(*student);
+        }
+        if (versions) {
+            versions->upsert(*student);
+        }
+        if (journal) {
+            Journal* target = journal;
+            uint64_t sequence = journal->recordEnrollment(studentId, course);
+            lock.unlock();
+            return target->commitPerPolicy(sequence);
+        }
         return true;
     }
     return false;
@@ -101,22 +301,163 @@ bool StudentManager::enrollStudentInCourse(uint32_t studentId, const std::string
  * @param studentId ID of the student
  * @param course Name of the course
  * @return true if student was found and removed from course, false otherwise
+ *         or if the journal commit required by the durability policy failed
  */
 bool StudentManager::removeStudentFromCourse(uint32_t studentId, const std::string& course) {
-    Student* student = getStudent(studentId);
-    if (student && student->isEnrolledIn(course)) {
-        student->removeCourse(course);
+    SMS_METRICS_SCOPE(Operation::RemoveFromCourse);
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    Student* student = students.find(studentId);
+    std::optional<uint32_t> courseId = CourseDictionary::instance().find(course);
+    if (student && courseId && student->isEnrolledInCourseId(*courseId)) {
+        student->removeCourseId(*courseId);
+        courseIndex.remove(*courseId, studentId);
+        if (columns) {
+            columns->updateCourses(*student);
+        }
+        if (versions) {
+            versions->upsert(*student);
+        }
+        if (journal) {
+            Journal* target = journal;
+            uint64_t sequence = journal->recordCourseRemoval(studentId, course);
+            lock.unlock();
+            return target->commitPerPolicy(sequence);
+        }
         return true;
     }
     return false;
 }
 
+/**
+ * @brief List the students enrolled in a course
+ * @param course Name of the course
+ * @return Vector of pointers to the enrolled Student objects, in ID order
+ * @details Looks the course up without interning it, so asking about an
+ *          unknown course does not grow the CourseDictionary
+ */
+std::vector<Student*> StudentManager::getStudentsInCourse(const std::string& course) {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    std::vector<Student*> result;
+    std::optional<uint32_t> courseId = CourseDictionary::instance().find(course);
+    if (!courseId) {
+        return result;
+    }
+    const RoaringBitmap& ids = courseIndex.students(*courseId);
+    result.reserve(ids.cardinality());
+    ids.forEach([&](uint32_t id) {
+        if (Student* student = students.find(id)) {
+            result.push_back(student);
+        }
+    });
+    return result;
+}
+
+/**
+ * @brief Count the students enrolled in a course
+ * @param course Name of the course
+ * @return Number of enrolled students, 0 for unknown courses
+ */
+size_t StudentManager::getCourseEnrollmentCount(const std::string& course) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    std::optional<uint32_t> courseId = CourseDictionary::instance().find(course);
+    return courseId ? courseIndex.count(*courseId) : 0;
+}
+
+/**
+ * @brief Evaluate a course query on the course index
+ * @param query Courses to combine
+ * @return Set of matching student IDs
+ * @details A course nobody was ever enrolled in is unknown to the
+ *          CourseDictionary: in allOf it empties the result, in anyOf and
+ *          noneOf it contributes nothing. The caller holds the lock.
+ */
+RoaringBitmap StudentManager::evaluateCourseQuery(const CourseQuery& query) const {
+    const CourseDictionary& dictionary = CourseDictionary::instance();
+    auto resolve = [&dictionary](const std::vector<std::string>& courses, bool& missing) {
+        std::vector<uint32_t> ids;
+        for (const auto& course : courses) {
+            if (std::optional<uint32_t> courseId = dictionary.find(course)) {
+                ids.push_back(*courseId);
+            } else {
+                missing = true;
+            }
+        }
+        return ids;
+    };
+    bool missingAll = false;
+    bool ignored = false;
+    std::vector<uint32_t> allOf = resolve(query.allOf, missingAll);
+    std::vector<uint32_t> anyOf = resolve(query.anyOf, ignored);
+    std::vector<uint32_t> noneOf = resolve(query.noneOf, ignored);
+
+    RoaringBitmap result;
+    if (missingAll) {
+        return result;
+    }
+    if (!allOf.empty()) {
+        result = courseIndex.matchAll(allOf);
+        if (!query.anyOf.empty()) {
+            result &= courseIndex.matchAny(anyOf);
+        }
+    } else if (!query.anyOf.empty()) {
+        result = courseIndex.matchAny(anyOf);
+    } else {
+        students.forEach([&result](const Student& student) {
+            result.add(static_cast<uint32_t>(student.getStudentId()));
+        });
+    }
+    if (!result.empty() && !noneOf.empty()) {
+        result -= courseIndex.matchAny(noneOf);
+    }
+    return result;
+}
+
+/**
+ * @brief Find the students matching a course set-algebra query
+ * @param query Courses to combine
+ * @return Matching IDs in ascending order
+ */
+std::vector<uint32_t> StudentManager::findStudentIdsByCourses(const CourseQuery& query) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return evaluateCourseQuery(query).toVector();
+}
+
+/**
+ * @brief Count the students matching a course set-algebra query
+ * @param query Courses to combine
+ * @return Number of matching students
+ */
+size_t StudentManager::countStudentsByCourses(const CourseQuery& query) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return static_cast<size_t>(evaluateCourseQuery(query).cardinality());
+}
+
 /**
  * @brief Get the total number of students in the system
  * @return Number of students currently managed
  */
 uint32_t StudentManager::getStudentCount() const {
-    return students.size();
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return static_cast<uint32_t>(students.size());
+}
+
+/**
+ * @brief Gets the course intern table shared by all students
+ * @return The process-wide CourseDictionary
+ * @details The table is global rather than per manager so that Student
+ *          objects built outside a manager (parsers, snapshots, tests) use
+ *          the same IDs
+ */
+CourseDictionary& StudentManager::getCourseDictionary() {
+    return CourseDictionary::instance();
+}
+
+/**
+ * @brief Gets the call counts and latency histograms of the instrumented operations
+ * @return Report summed over all threads
+ */
+MetricsReport StudentManager::getStats() {
+    return OperationMetrics::collect();
 }
 
 /**
@@ -124,9 +465,177 @@ uint32_t StudentManager::getStudentCount() const {
  * @return Vector containing copies of all Student objects
  */
 std::vector<Student> StudentManager::getAllStudents() const {
+    SMS_METRICS_SCOPE(Operation::GetAllStudents);
+    std::shared_lock<std::shared_mutex> lock(mutex);
     std::vector<Student> result;
-    for (const auto& pair : students) {
-        result.push_back(pair.second);
+    if (versions) {
+        // Copy from a snapshot so writers are not held up by the copying
+        StudentSnapshot view = versions->snapshot();
+        lock.unlock();
+        result.reserve(view.size());
+        view.forEach([&result](const Student& student) { result.push_back(student); });
+        return result;
     }
+    result.reserve(students.size());
+    students.forEach([&result](const Student& student) { result.push_back(student); });
     return result;
 }
+
+/**
+ * @brief Turn the columnar copy of the students on or off
+ * @param enabled true to build and maintain it, false to drop it
+ */
+void StudentManager::setColumnarStoreEnabled(bool enabled) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    if (!enabled) {
+        columns.reset();
+        return;
+    }
+    if (columns) {
+        return;
+    }
+    columns = std::make_unique<ColumnarStudentStore>();
+    columns->reserve(students.size());
+    students.forEach([this](const Student& student) { columns->upsert(student); });
+}
+
+/**
+ * @brief Check whether the columnar copy is maintained
+ * @return true if setColumnarStoreEnabled(true) is in effect
+ */
+bool StudentManager::isColumnarStoreEnabled() const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return columns != nullptr;
+}
+
+/**
+ * @brief Turn multi-version snapshots on or off
+ * @param enabled true to build the versioned tree from the current students
+ *                and keep it up to date, false to drop it
+ */
+void StudentManager::setSnapshotsEnabled(bool enabled) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    if (!enabled) {
+        versions.reset();
+        return;
+    }
+    if (versions) {
+        return;
+    }
+    versions = std::make_unique<VersionedStudentStore>();
+    students.forEach([this](const Student& student) { versions->upsert(student); });
+}
+
+/**
+ * @brief Check whether multi-version snapshots are maintained
+ * @return true if they are enabled
+ */
+bool StudentManager::isSnapshotsEnabled() const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return versions != nullptr;
+}
+
+/**
+ * @brief Take a point-in-time view of the students
+ * @return Snapshot that stays unchanged whatever happens to the manager
+ * @details O(1) with snapshots enabled. Otherwise the students are copied
+ *          into a new tree under the shared lock.
+ */
+StudentSnapshot StudentManager::snapshot() const {
+    uint64_t journalSequence = 0;
+    return snapshot(journalSequence);
+}
+
+/**
+ * @brief Take a point-in-time view of the students and the journal position it matches
+ * @param journalSequence Receives the sequence number of the last journal
+ *        record the view contains, 0 without a journal
+ * @return Snapshot that stays unchanged whatever happens to the manager
+ */
+StudentSnapshot StudentManager::snapshot(uint64_t& journalSequence) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    journalSequence = journal ? journal->getAppendedSequence() : 0;
+    if (versions) {
+        return versions->snapshot();
+    }
+    VersionedStudentStore copy;
+    students.forEach([&copy](const Student& student) { copy.upsert(student); });
+    return copy.snapshot();
+}
+
+/**
+ * @brief Find the students whose age lies in a range
+ * @param minAge Smallest age to include
+ * @param maxAge Largest age to include
+ * @return Matching IDs in ascending order
+ */
+std::vector<uint32_t> StudentManager::findStudentIdsByAgeRange(int minAge, int maxAge) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    if (columns) {
+        return columns->filterByAgeRange(minAge, maxAge);
+    }
+    std::vector<uint32_t> result;
+    students.forEach([&](const Student& student) {
+        if (student.getAge() >= minAge && student.getAge() <= maxAge) {
+            result.push_back(static_cast<uint32_t>(student.getStudentId()));
+        }
+    });
+    return result;
+}
+
+/**
+ * @brief Count the students whose age lies in a range
+ * @param minAge Smallest age to include
+ * @param maxAge Largest age to include
+ * @return Number of matching students
+ */
+size_t StudentManager::countStudentsByAgeRange(int minAge, int maxAge) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    if (columns) {
+        return columns->countByAgeRange(minAge, maxAge);
+    }
+    size_t count = 0;
+    students.forEach([&](const Student& student) {
+        count += student.getAge() >= minAge && student.getAge() <= maxAge;
+    });
+    return count;
+}
+
+/**
+ * @brief Find the students whose ID lies in a range
+ * @param firstId Smallest ID to include
+ * @param lastId Largest ID to include
+ * @return Matching IDs in ascending order
+ */
+std::vector<uint32_t> StudentManager::findStudentIdsByIdRange(uint32_t firstId, uint32_t lastId) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    if (columns) {
+        return columns->filterByIdRange(firstId, lastId);
+    }
+    std::vector<uint32_t> result;
+    students.forEach([&](const Student& student) {
+        uint32_t id = static_cast<uint32_t>(student.getStudentId());
+        if (id >= firstId && id <= lastId) {
+            result.push_back(id);
+        }
+    });
+    return result;
+}
+
+/**
+ * @brief Attach a journal that records every successful mutation
+ * @param journal Journal to append to, or nullptr to stop journaling
+ */
+void StudentManager::setJournal(Journal* journal) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    this->journal = journal;
+}
+
+/**
+ * @brief Get the attached journal
+ * @return The attached journal, nullptr if none
+ */
+Journal* StudentManager::getJournal() const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return journal;
+}
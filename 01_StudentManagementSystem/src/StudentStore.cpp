@@ -0,0 +1,236 @@
+#include "StudentStore.h"
+#include <algorithm>
+
+/**
+ * @brief Constructor
+ * @param idStride Distance between the IDs to store; unused
+ */
+MapStudentStore::MapStudentStore(uint32_t idStride) {
+    (void)idStride;
+}
+
+/**
+ * @brief Find a student
+ * @param studentId ID to look for
+ * @return Pointer to the stored Student, nullptr if there is none
+ */
+Student* MapStudentStore::find(uint32_t studentId) {
+    auto it = students.find(studentId);
+    return it != students.end() ? &it->second : nullptr;
+}
+
+/**
+ * @brief Find a student
+ * @param studentId ID to look for
+ * @return Pointer to the stored Student, nullptr if there is none
+ */
+const Student* MapStudentStore::find(uint32_t studentId) const {
+    auto it = students.find(studentId);
+    return it != students.end() ? &it->second : nullptr;
+}
+
+/**
+ * @brief Store a student, replacing any student with the same ID
+ * @param studentId ID to store the student under
+ * @param student Student to take over
+ * @return Reference to the stored Student
+ * @details Appending IDs in ascending order hits the end() hint, so bulk
+ *          loads of sorted data stay linear
+ */
+Student& MapStudentStore::insertOrAssign(uint32_t studentId, Student&& student) {
+    return students.insert_or_assign(students.end(), studentId, std::move(student))->second;
+}
+
+/**
+ * @brief Remove a student
+ * @param studentId ID of the student to remove
+ * @return true if a student was removed, false if there was none
+ */
+bool MapStudentStore::erase(uint32_t studentId) {
+    return students.erase(studentId) > 0;
+}
+
+/**
+ * @brief Get the number of stored students
+ * @return Student count
+ */
+std::size_t MapStudentStore::size() const {
+    return students.size();
+}
+
+/**
+ * @brief Remove every student
+ */
+void MapStudentStore::clear() {
+    students.clear();
+}
+
+/**
+ * @brief Constructor
+ * @param idStride Distance between the IDs to store, at least 1
+ * @details Creates an empty store
+ */
+DenseStudentStore::DenseStudentStore(uint32_t idStride)
+    : baseId(0), stride(std::max(idStride, 1u)), count(0) {}
+
+/**
+ * @brief Get the slot of an ID inside the dense range
+ * @param studentId ID to look for
+ * @return Pointer to the slot, nullptr if the ID is outside the range
+ */
+std::optional<Student>* DenseStudentStore::slotFor(uint32_t studentId) {
+    if (studentId < baseId) {
+        return nullptr;
+    }
+    uint32_t offset = studentId - baseId;
+    if (stride != 1) {
+        if (offset % stride != 0) {
+            return nullptr;
+        }
+        offset /= stride;
+    }
+    return offset < slots.size() ? &slots[offset] : nullptr;
+}
+
+/**
+ * @brief Get the slot of an ID inside the dense range
+ * @param studentId ID to look for
+ * @return Pointer to the slot, nullptr if the ID is outside the range
+ */
+const std::optional<Student>* DenseStudentStore::slotFor(uint32_t studentId) const {
+    if (studentId < baseId) {
+        return nullptr;
+    }
+    uint32_t offset = studentId - baseId;
+    if (stride != 1) {
+        if (offset % stride != 0) {
+            return nullptr;
+        }
+        offset /= stride;
+    }
+    return offset < slots.size() ? &slots[offset] : nullptr;
+}
+
+/**
+ * @brief Find a student
+ * @param studentId ID to look for
+ * @return Pointer to the stored Student, nullptr if there is none
+ */
+Student* DenseStudentStore::find(uint32_t studentId) {
+    std::optional<Student>* slot = slotFor(studentId);
+    if (slot && *slot) {
+        return &**slot;
+    }
+    if (overflow.empty()) {
+        return nullptr;
+    }
+    auto it = overflow.find(studentId);
+    return it != overflow.end() ? &it->second : nullptr;
+}
+
+/**
+ * @brief Find a student
+ * @param studentId ID to look for
+ * @return Pointer to the stored Student, nullptr if there is none
+ */
+const Student* DenseStudentStore::find(uint32_t studentId) const {
+    const std::optional<Student>* slot = slotFor(studentId);
+    if (slot && *slot) {
+        return &**slot;
+    }
+    if (overflow.empty()) {
+        return nullptr;
+    }
+    auto it = overflow.find(studentId);
+    return it != overflow.end() ? &it->second : nullptr;
+}
+
+/**
+ * @brief Store a student, replacing any student with the same ID
+ * @param studentId ID to store the student under
+ * @param student Student to take over
+ * @return Reference to the stored Student
+ * @details A replaced student keeps its address. New IDs extend the dense
+ *          range when they are at most MAX_GAP slots away from it.
+ */
+Student& DenseStudentStore::insertOrAssign(uint32_t studentId, Student&& student) {
+    if (Student* existing = find(studentId)) {
+        *existing = std::move(student);
+        return *existing;
+    }
+
+    if (slots.empty()) {
+        baseId = studentId;
+        slots.emplace_back();
+    } else if (studentId >= baseId && (studentId - baseId) % stride == 0) {
+        std::size_t index = (studentId - baseId) / stride;
+        if (index >= slots.size() && index - slots.size() < MAX_GAP) {
+            slots.resize(index + 1);
+        }
+    } else if (studentId < baseId && (baseId - studentId) % stride == 0 &&
+               (baseId - studentId) / stride <= MAX_GAP) {
+        for (uint32_t id = baseId; id > studentId; id -= stride) {
+            slots.emplace_front();
+        }
+        baseId = studentId;
+    }
+
+    ++count;
+    if (std::optional<Student>* slot = slotFor(studentId)) {
+        slot->emplace(std::move(student));
+        return **slot;
+    }
+    return overflow.emplace(studentId, std::move(student)).first->second;
+}
+
+/**
+ * @brief Remove a student
+ * @param studentId ID of the student to remove
+ * @return true if a student was removed, false if there was none
+ */
+bool DenseStudentStore::erase(uint32_t studentId) {
+    std::optional<Student>* slot = slotFor(studentId);
+    if (slot && *slot) {
+        slot->reset();
+        --count;
+        trim();
+        return true;
+    }
+    if (overflow.erase(studentId) > 0) {
+        --count;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Release empty slots at both ends of the dense range
+ * @details pop_front/pop_back leave the remaining slots where they are
+ */
+void DenseStudentStore::trim() {
+    while (!slots.empty() && !slots.back()) {
+        slots.pop_back();
+    }
+    while (!slots.empty() && !slots.front()) {
+        slots.pop_front();
+        baseId += stride;
+    }
+}
+
+/**
+ * @brief Get the number of stored students
+ * @return Student count
+ */
+std::size_t DenseStudentStore::size() const {
+    return count;
+}
+
+/**
+ * @brief Remove every student
+ */
+void DenseStudentStore::clear() {
+    slots.clear();
+    overflow.clear();
+    baseId = 0;
+    count = 0;
+}
@@ -0,0 +1,245 @@
+#include "Tracing.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Thread buffers and the state of the running session
+ */
+struct TraceRegistry {
+    std::mutex mutex;                          ///< Guards everything below
+    std::vector<TraceThreadBuffer*> buffers;   ///< Buffers of running and exited threads
+    uint32_t nextThreadId = 1;                 ///< tid of the next registered thread
+    std::string path;                          ///< Output file of the running session
+    uint64_t sessionStart = 0;                 ///< Steady clock time the session started
+};
+
+/**
+ * @brief Get the process-wide registry
+ * @return The registry
+ * @details Never destroyed, so threads exiting after static destruction
+ *          has begun can still hand their buffers in
+ */
+TraceRegistry& registry() {
+    static TraceRegistry* instance = new TraceRegistry();
+    return *instance;
+}
+
+/**
+ * @brief Free the buffers of exited threads
+ * @param traces Registry, locked by the caller
+ */
+void deleteFinishedBuffers(TraceRegistry& traces) {
+    auto finished = [](TraceThreadBuffer* buffer) {
+        if (!buffer->finished.load(std::memory_order_acquire)) {
+            return false;
+        }
+        delete buffer;
+        return true;
+    };
+    traces.buffers.erase(std::remove_if(traces.buffers.begin(), traces.buffers.end(), finished),
+                         traces.buffers.end());
+}
+
+/**
+ * @brief Marks the calling thread's buffer finished when the thread exits
+ * @details The buffer stays registered so stop() still writes its events
+ */
+struct TraceBufferOwner {
+    TraceThreadBuffer* buffer = nullptr;
+
+    ~TraceBufferOwner() {
+        if (!buffer) {
+            return;
+        }
+        TraceRegistry& traces = registry();
+        std::lock_guard<std::mutex> lock(traces.mutex);
+        buffer->finished.store(true, std::memory_order_release);
+        currentTraceBuffer = nullptr;
+    }
+};
+
+thread_local TraceBufferOwner traceBufferOwner;
+
+/**
+ * @brief Write one event as a complete ("X") trace event
+ * @param out Stream to write to
+ * @param event The event
+ * @param threadId tid of the thread that recorded it
+ * @param sessionStart Time the timestamps are relative to
+ */
+void writeEvent(std::ostream& out, const TraceEvent& event, uint32_t threadId, uint64_t sessionStart) {
+    // Timestamps are in microseconds; keep nanosecond precision
+    char times[64];
+    std::snprintf(times, sizeof(times), "\"ts\":%.3f,\"dur\":%.3f",
+                  static_cast<double>(event.startNanos - sessionStart) / 1000.0,
+                  static_cast<double>(event.durationNanos) / 1000.0);
+    out << "{\"name\":\"" << event.name << "\",\"cat\":\"sms\",\"ph\":\"X\"," << times
+        << ",\"pid\":1,\"tid\":" << threadId;
+    if (event.argName) {
+        out << ",\"args\":{\"" << event.argName << "\":" << event.argValue << "}";
+    }
+    out << "}";
+}
+
+/**
+ * @brief Starts a session from SMS_TRACE_FILE and writes whatever session is running at exit
+ */
+struct EnvironmentTrace {
+    EnvironmentTrace() {
+        const char* path = std::getenv("SMS_TRACE_FILE");
+        if (path && *path) {
+            Tracer::start(path);
+        }
+    }
+
+    ~EnvironmentTrace() {
+        Tracer::stop();
+    }
+};
+
+EnvironmentTrace environmentTrace;
+
+} // namespace
+
+/**
+ * @brief Free the event chunks
+ */
+TraceThreadBuffer::~TraceThreadBuffer() {
+    for (auto& chunk : chunks) {
+        delete[] chunk.load(std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Create and register the calling thread's buffer
+ * @return The new buffer
+ */
+TraceThreadBuffer* Tracer::registerThread() {
+    TraceThreadBuffer* created = new TraceThreadBuffer();
+    {
+        TraceRegistry& traces = registry();
+        std::lock_guard<std::mutex> lock(traces.mutex);
+        created->threadId = traces.nextThreadId++;
+        traces.buffers.push_back(created);
+    }
+    traceBufferOwner.buffer = created;
+    currentTraceBuffer = created;
+    return created;
+}
+
+/**
+ * @brief Start recording spans
+ * @param path File the trace is written to by stop()
+ * @return false if a session is already running
+ * @details Starting a new session makes every thread discard the events of
+ *          the previous one the next time it records
+ */
+bool Tracer::start(const std::string& path) {
+    TraceRegistry& traces = registry();
+    std::lock_guard<std::mutex> lock(traces.mutex);
+    if (enabled.load(std::memory_order_relaxed)) {
+        return false;
+    }
+    deleteFinishedBuffers(traces);
+    traces.path = path;
+    traces.sessionStart = now();
+    session.fetch_add(1, std::memory_order_release);
+    enabled.store(true, std::memory_order_relaxed);
+    return true;
+}
+
+/**
+ * @brief Stop recording and write the trace file
+ * @return true if a session was running and its file was written
+ * @details Spans still open on other threads are not included. Events that
+ *          did not fit in a thread's buffer are counted under
+ *          otherData.droppedEvents.
+ */
+bool Tracer::stop() {
+    TraceRegistry& traces = registry();
+    std::lock_guard<std::mutex> lock(traces.mutex);
+    if (!enabled.load(std::memory_order_relaxed)) {
+        return false;
+    }
+    enabled.store(false, std::memory_order_relaxed);
+    uint64_t current = session.load(std::memory_order_relaxed);
+
+    std::ofstream outFile(traces.path, std::ios::trunc);
+    if (!outFile.is_open()) {
+        std::cerr << "Error: Unable to open trace file for writing: " << traces.path << std::endl;
+        deleteFinishedBuffers(traces);
+        return false;
+    }
+
+    outFile << "{\"traceEvents\":[";
+    bool first = true;
+    uint64_t dropped = 0;
+    for (TraceThreadBuffer* buffer : traces.buffers) {
+        if (buffer->session.load(std::memory_order_acquire) != current) {
+            continue;
+        }
+        size_t count = buffer->count.load(std::memory_order_acquire);
+        dropped += buffer->dropped.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < count; ++i) {
+            const TraceEvent* chunk = buffer->chunks[i / TraceThreadBuffer::CHUNK_EVENTS].load(std::memory_order_relaxed);
+            const TraceEvent& event = chunk[i % TraceThreadBuffer::CHUNK_EVENTS];
+            // Spans opened before the session started would get a negative timestamp
+            if (event.startNanos < traces.sessionStart) {
+                continue;
+            }
+            outFile << (first ? "\n" : ",\n");
+            writeEvent(outFile, event, buffer->threadId, traces.sessionStart);
+            first = false;
+        }
+    }
+    outFile << "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"droppedEvents\":" << dropped << "}}\n";
+    outFile.close();
+    deleteFinishedBuffers(traces);
+
+    if (outFile.fail()) {
+        std::cerr << "Error: Unable to write trace file: " << traces.path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Append a finished span to the calling thread's buffer
+ * @param event The span
+ * @details The first span of a new session resets the buffer. Only the
+ *          calling thread writes it, so the counters need no read-modify-write.
+ */
+void Tracer::record(const TraceEvent& event) {
+    TraceThreadBuffer* buffer = currentTraceBuffer;
+    if (!buffer) {
+        buffer = registerThread();
+    }
+
+    uint64_t current = session.load(std::memory_order_acquire);
+    if (buffer->session.load(std::memory_order_relaxed) != current) {
+        buffer->count.store(0, std::memory_order_relaxed);
+        buffer->dropped.store(0, std::memory_order_relaxed);
+        buffer->session.store(current, std::memory_order_release);
+    }
+
+    size_t index = buffer->count.load(std::memory_order_relaxed);
+    if (index >= TraceThreadBuffer::MAX_EVENTS) {
+        buffer->dropped.store(buffer->dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return;
+    }
+    std::atomic<TraceEvent*>& slot = buffer->chunks[index / TraceThreadBuffer::CHUNK_EVENTS];
+    TraceEvent* chunk = slot.load(std::memory_order_relaxed);
+    if (!chunk) {
+        chunk = new TraceEvent[TraceThreadBuffer::CHUNK_EVENTS];
+        slot.store(chunk, std::memory_order_relaxed);
+    }
+    chunk[index % TraceThreadBuffer::CHUNK_EVENTS] = event;
+    buffer->count.store(index + 1, std::memory_order_release);
+}
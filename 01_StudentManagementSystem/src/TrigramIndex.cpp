@@ -0,0 +1,147 @@
+#include "TrigramIndex.h"
+#include <algorithm>
+#include <cctype>
+
+/**
+ * @brief Fold a string to lower case the way searches compare names
+ * @param text String to fold
+ * @return Lower-case copy of text
+ */
+std::string TrigramIndex::fold(std::string_view text) {
+    std::string folded(text);
+    for (char& c : folded) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    return folded;
+}
+
+/**
+ * @brief Get the distinct trigrams of a folded string
+ * @param folded Folded string
+ * @return Sorted, deduplicated trigram keys
+ */
+std::vector<uint32_t> TrigramIndex::trigramsOf(std::string_view folded) {
+    std::vector<uint32_t> grams;
+    if (folded.size() < GRAM_SIZE) {
+        return grams;
+    }
+    grams.reserve(folded.size() - GRAM_SIZE + 1);
+    for (std::size_t i = 0; i + GRAM_SIZE <= folded.size(); ++i) {
+        grams.push_back(static_cast<uint32_t>(static_cast<unsigned char>(folded[i])) << 16 |
+                        static_cast<uint32_t>(static_cast<unsigned char>(folded[i + 1])) << 8 |
+                        static_cast<uint32_t>(static_cast<unsigned char>(folded[i + 2])));
+    }
+    std::sort(grams.begin(), grams.end());
+    grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+    return grams;
+}
+
+/**
+ * @brief Index a name
+ * @param studentId ID of the student
+ * @param name Name as stored in the Student
+ */
+void TrigramIndex::add(uint32_t studentId, std::string_view name) {
+    for (uint32_t gram : trigramsOf(fold(name))) {
+        std::vector<uint32_t>& ids = postings[gram];
+        if (ids.empty() || ids.back() < studentId) {
+            ids.push_back(studentId);
+        } else {
+            auto it = std::lower_bound(ids.begin(), ids.end(), studentId);
+            if (it == ids.end() || *it != studentId) {
+                ids.insert(it, studentId);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Remove a previously indexed name
+ * @param studentId ID of the student
+ * @param name Name the student was indexed with
+ */
+void TrigramIndex::remove(uint32_t studentId, std::string_view name) {
+    for (uint32_t gram : trigramsOf(fold(name))) {
+        auto list = postings.find(gram);
+        if (list == postings.end()) {
+            continue;
+        }
+        std::vector<uint32_t>& ids = list->second;
+        auto it = std::lower_bound(ids.begin(), ids.end(), studentId);
+        if (it != ids.end() && *it == studentId) {
+            ids.erase(it);
+        }
+        if (ids.empty()) {
+            postings.erase(list);
+        }
+    }
+}
+
+/**
+ * @brief Drop every posting list
+ */
+void TrigramIndex::clear() {
+    postings.clear();
+}
+
+/**
+ * @brief Check whether a query can be answered from the index
+ * @param foldedQuery Query already passed through fold()
+ * @return true if the query has at least GRAM_SIZE bytes
+ */
+bool TrigramIndex::canNarrow(std::string_view foldedQuery) {
+    return foldedQuery.size() >= GRAM_SIZE;
+}
+
+/**
+ * @brief Get the IDs whose names may contain a query
+ * @param foldedQuery Query already passed through fold()
+ * @return Ascending IDs whose names contain every trigram of the query
+ * @details Posting lists are intersected from the shortest up, so the work
+ *          is bounded by the rarest trigram of the query.
+ */
+std::vector<uint32_t> TrigramIndex::candidates(std::string_view foldedQuery) const {
+    std::vector<const std::vector<uint32_t>*> lists;
+    for (uint32_t gram : trigramsOf(foldedQuery)) {
+        auto list = postings.find(gram);
+        if (list == postings.end()) {
+            return {};
+        }
+        lists.push_back(&list->second);
+    }
+    if (lists.empty()) {
+        return {};
+    }
+    std::sort(lists.begin(), lists.end(),
+              [](const std::vector<uint32_t>* a, const std::vector<uint32_t>* b) {
+                  return a->size() < b->size();
+              });
+
+    // The running result is never longer than the next list, so probe the
+    // longer list by binary search instead of merging through all of it
+    std::vector<uint32_t> result = *lists.front();
+    for (std::size_t i = 1; i < lists.size() && !result.empty(); ++i) {
+        const std::vector<uint32_t>& ids = *lists[i];
+        auto position = ids.begin();
+        std::size_t kept = 0;
+        for (uint32_t id : result) {
+            position = std::lower_bound(position, ids.end(), id);
+            if (position == ids.end()) {
+                break;
+            }
+            if (*position == id) {
+                result[kept++] = id;
+            }
+        }
+        result.resize(kept);
+    }
+    return result;
+}
+
+/**
+ * @brief Get the number of distinct trigrams in the index
+ * @return Number of posting lists
+ */
+std::size_t TrigramIndex::getTrigramCount() const {
+    return postings.size();
+}
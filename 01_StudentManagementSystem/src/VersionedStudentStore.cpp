@@ -0,0 +1,192 @@
+#include "VersionedStudentStore.h"
+#include <atomic>
+
+namespace {
+
+/**
+ * @brief Get the tree digit of an ID at a level
+ */
+inline unsigned digit(uint32_t studentId, unsigned level) {
+    return (studentId >> (VersionedStudentStore::BITS * level)) & (VersionedStudentStore::FANOUT - 1);
+}
+
+/**
+ * @brief Check whether a tree of a given height has room for an ID
+ */
+inline bool covers(unsigned height, uint32_t studentId) {
+    unsigned bits = VersionedStudentStore::BITS * (height + 1);
+    return bits >= 32 || (studentId >> bits) == 0;
+}
+
+/**
+ * @brief Look up an ID in a tree
+ */
+const Student* findIn(const StudentVersionNode* node, unsigned height, uint32_t studentId) {
+    if (!node || !covers(height, studentId)) {
+        return nullptr;
+    }
+    for (unsigned level = height; level > 0; --level) {
+        node = node->children[digit(studentId, level)].get();
+        if (!node) {
+            return nullptr;
+        }
+    }
+    return node->students[digit(studentId, 0)].get();
+}
+
+/**
+ * @brief Make a node writable for the owner
+ * @param slot Pointer to the node; may be empty
+ * @param leaf true for a leaf, false for an inner node
+ * @details An empty slot gets a new node. A node someone else still
+ *          refers to is replaced by a copy, which bumps its children's
+ *          reference counts so they are copied too when their turn comes.
+ */
+StudentVersionNode& writable(std::shared_ptr<StudentVersionNode>& slot, bool leaf) {
+    if (!slot) {
+        slot = std::make_shared<StudentVersionNode>();
+        if (leaf) {
+            slot->students.resize(VersionedStudentStore::FANOUT);
+        } else {
+            slot->children.resize(VersionedStudentStore::FANOUT);
+        }
+    } else if (slot.use_count() > 1) {
+        slot = std::make_shared<StudentVersionNode>(*slot);
+    } else {
+        // Order our writes after the reads of the snapshot that released it
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+    return *slot;
+}
+
+} // namespace
+
+/**
+ * @brief Default constructor
+ * @details Creates an empty snapshot
+ */
+StudentSnapshot::StudentSnapshot() : height(0), count(0) {}
+
+/**
+ * @brief Constructor
+ * @param root Root of the tree to share
+ * @param height Inner levels above the leaves
+ * @param count Number of students in the tree
+ */
+StudentSnapshot::StudentSnapshot(std::shared_ptr<const StudentVersionNode> root, unsigned height,
+                                 std::size_t count)
+    : root(std::move(root)), height(height), count(count) {}
+
+/**
+ * @brief Find a student
+ * @param studentId ID to look for
+ * @return Pointer to the Student, nullptr if the snapshot has none
+ */
+const Student* StudentSnapshot::find(uint32_t studentId) const {
+    return findIn(root.get(), height, studentId);
+}
+
+/**
+ * @brief Get the number of students
+ * @return Student count
+ */
+std::size_t StudentSnapshot::size() const {
+    return count;
+}
+
+/**
+ * @brief Check whether the snapshot has no students
+ * @return true if it is empty
+ */
+bool StudentSnapshot::empty() const {
+    return count == 0;
+}
+
+/**
+ * @brief Default constructor
+ * @details Creates an empty store
+ */
+VersionedStudentStore::VersionedStudentStore() : height(0), count(0) {}
+
+/**
+ * @brief Get a writable leaf for an ID, copying shared nodes on the way
+ * @param studentId ID the leaf must hold
+ * @return The leaf
+ */
+StudentVersionNode* VersionedStudentStore::leafFor(uint32_t studentId) {
+    // Grow the tree upwards until it has room for the ID
+    while (root && !covers(height, studentId)) {
+        auto grown = std::make_shared<StudentVersionNode>();
+        grown->children.resize(FANOUT);
+        grown->children[0] = std::move(root);
+        root = std::move(grown);
+        height++;
+    }
+    if (!root) {
+        while (!covers(height, studentId)) {
+            height++;
+        }
+    }
+
+    std::shared_ptr<StudentVersionNode>* slot = &root;
+    for (unsigned level = height; level > 0; --level) {
+        StudentVersionNode& node = writable(*slot, false);
+        slot = &node.children[digit(studentId, level)];
+    }
+    return &writable(*slot, true);
+}
+
+/**
+ * @brief Store a copy of a student, replacing any older version
+ * @param student Student to copy
+ */
+void VersionedStudentStore::upsert(const Student& student) {
+    uint32_t studentId = static_cast<uint32_t>(student.getStudentId());
+    std::shared_ptr<const Student>& entry = leafFor(studentId)->students[digit(studentId, 0)];
+    if (!entry) {
+        count++;
+    }
+    entry = std::make_shared<const Student>(student);
+}
+
+/**
+ * @brief Remove a student
+ * @param studentId ID of the student to remove
+ * @return true if a student was removed, false if there was none
+ * @details Emptied nodes are kept; they are reused when the ID comes back
+ */
+bool VersionedStudentStore::erase(uint32_t studentId) {
+    // Look before copying so a miss leaves shared nodes alone
+    if (!findIn(root.get(), height, studentId)) {
+        return false;
+    }
+    leafFor(studentId)->students[digit(studentId, 0)].reset();
+    count--;
+    return true;
+}
+
+/**
+ * @brief Remove every student
+ * @details Existing snapshots keep their students
+ */
+void VersionedStudentStore::clear() {
+    root.reset();
+    height = 0;
+    count = 0;
+}
+
+/**
+ * @brief Get the number of students
+ * @return Student count
+ */
+std::size_t VersionedStudentStore::size() const {
+    return count;
+}
+
+/**
+ * @brief Take a snapshot of the current students
+ * @return View sharing the current tree, O(1)
+ */
+StudentSnapshot VersionedStudentStore::snapshot() const {
+    return StudentSnapshot(root, height, count);
+}
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include "BackgroundSaver.h"
+#include <chrono>
+#include <cstdio>  // for remove()
+#include <string>
+#include <vector>
+
+// Test fixture for BackgroundSaver class
+class BackgroundSaverTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // One file per test, so tests run in parallel by ctest do not clash
+        const std::string testName = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        testFilePath = "test_background_saver_" + testName + ".csv";
+        fileManager = std::make_unique<FileManager>(testFilePath);
+        manager.setSnapshotsEnabled(true);
+        manager.addStudent("John Doe", "john.doe@example.com", 20);
+        manager.addStudent("Jane Smith", "jane.smith@example.com", 22);
+        manager.enrollStudentInCourse(1000, "CS101");
+    }
+
+    void TearDown() override {
+        std::remove(testFilePath.c_str());
+    }
+
+    std::vector<std::string> savedNames() {
+        std::vector<std::string> names;
+        for (const Student& student : fileManager->loadStudents()) {
+            names.push_back(student.getName());
+        }
+        return names;
+    }
+
+    std::string testFilePath;
+    std::unique_ptr<FileManager> fileManager;
+    StudentManager manager;
+};
+
+// Test that a requested save writes the students
+TEST_F(BackgroundSaverTest, SaveWritesFile) {
+    BackgroundSaver saver(manager, *fileManager);
+    std::shared_future<bool> saved = saver.requestSave();
+    EXPECT_TRUE(saved.get());
+    saver.waitIdle();
+    EXPECT_FALSE(saver.isSaving());
+    EXPECT_EQ(saver.getCompletedSaveCount(), 1);
+
+    std::vector<Student> loaded = fileManager->loadStudents();
+    ASSERT_EQ(loaded.size(), 2);
+    EXPECT_EQ(loaded[0].toString(), manager.getStudent(1000)->toString());
+    EXPECT_EQ(loaded[1].toString(), manager.getStudent(1001)->toString());
+}
+
+// Test that changes made after the request are not written by that save
+TEST_F(BackgroundSaverTest, SaveWritesStateAtRequest) {
+    BackgroundSaver saver(manager, *fileManager);
+    std::shared_future<bool> saved = saver.requestSave();
+    manager.addStudent("Bob Johnson", "bob.johnson@example.com", 19);
+    manager.deleteStudent(1000);
+
+    ASSERT_TRUE(saved.get());
+    EXPECT_EQ(savedNames(), (std::vector<std::string>{"John Doe", "Jane Smith"}));
+    EXPECT_EQ(manager.getStudentCount(), 2);
+}
+
+// Test that requests made while a save waits are merged into it
+TEST_F(BackgroundSaverTest, RequestsCoalesce) {
+    for (int i = 0; i < 50000; ++i) {
+        manager.addStudent("Filler Student", "filler@example.com", 20);
+    }
+    BackgroundSaver saver(manager, *fileManager);
+
+    std::shared_future<bool> first = saver.requestSave();
+    manager.addStudent("Second Request", "second@example.com", 21);
+    std::shared_future<bool> second = saver.requestSave();
+    manager.addStudent("Third Request", "third@example.com", 22);
+    std::shared_future<bool> third = saver.requestSave();
+    bool firstStillPending = first.wait_for(std::chrono::seconds(0)) != std::future_status::ready;
+
+    EXPECT_TRUE(first.get());
+    EXPECT_TRUE(second.get());
+    EXPECT_TRUE(third.get());
+    saver.waitIdle();
+    // Unless the first save finished in between, the later requests shared one save
+    if (firstStillPending) {
+        EXPECT_LE(saver.getCompletedSaveCount(), 2);
+    }
+
+    // The last save contains everything up to the last request
+    std::vector<std::string> names = savedNames();
+    ASSERT_EQ(names.size(), 50004);
+    EXPECT_EQ(names.back(), "Third Request");
+}
+
+// Test that destroying the saver finishes the waiting save
+TEST_F(BackgroundSaverTest, DestructorFinishesSave) {
+    std::shared_future<bool> saved;
+    {
+        BackgroundSaver saver(manager, *fileManager);
+        saved = saver.requestSave();
+    }
+    EXPECT_EQ(saved.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    EXPECT_TRUE(saved.get());
+    EXPECT_EQ(savedNames().size(), 2);
+}
+
+// Test that a failed save is reported through the future
+TEST_F(BackgroundSaverTest, FailedSave) {
+    FileManager unwritable("no_such_directory/students.csv");
+    BackgroundSaver saver(manager, unwritable);
+    ::testing::internal::CaptureStderr();
+    bool saved = saver.requestSave().get();
+    ::testing::internal::GetCapturedStderr();
+    EXPECT_FALSE(saved);
+}
+
+// Test saving a manager without versions, which copies the students per request
+TEST_F(BackgroundSaverTest, WithoutSnapshots) {
+    manager.setSnapshotsEnabled(false);
+    BackgroundSaver saver(manager, *fileManager);
+    EXPECT_TRUE(saver.requestSave().get());
+    EXPECT_EQ(savedNames(), (std::vector<std::string>{"John Doe", "Jane Smith"}));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
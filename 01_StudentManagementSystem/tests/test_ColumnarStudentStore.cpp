@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include "ColumnarStudentStore.h"
+#include <algorithm>
+#include <map>
+#include <random>
+
+// Test fixture for ColumnarStudentStore class
+class ColumnarStudentStoreTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        Student john(1000, "John Doe", "john.doe@example.com", 20);
+        john.addCourse("CS101");
+        john.addCourse("MATH202");
+        store.upsert(john);
+        store.upsert(Student(1001, "Jane Smith", "jane.smith@example.com", 22));
+        store.upsert(Student(1002, "Bob Johnson", "bob.johnson@example.com", 19));
+    }
+
+    ColumnarStudentStore store;
+};
+
+// Test age and ID range filters
+TEST_F(ColumnarStudentStoreTest, RangeFilters) {
+    EXPECT_EQ(store.size(), 3);
+    EXPECT_EQ(store.filterByAgeRange(20, 22), (std::vector<uint32_t>{1000, 1001}));
+    EXPECT_EQ(store.filterByAgeRange(0, 100), (std::vector<uint32_t>{1000, 1001, 1002}));
+    EXPECT_TRUE(store.filterByAgeRange(23, 100).empty());
+    EXPECT_TRUE(store.filterByAgeRange(22, 20).empty());
+    EXPECT_EQ(store.countByAgeRange(19, 20), 2);
+    
+    EXPECT_EQ(store.filterByIdRange(1001, 5000), (std::vector<uint32_t>{1001, 1002}));
+    EXPECT_EQ(store.filterByIdRange(0, 1000), (std::vector<uint32_t>{1000}));
+    EXPECT_TRUE(store.filterByIdRange(2000, 3000).empty());
+}
+
+// Test that rows come back as equal Students
+TEST_F(ColumnarStudentStoreTest, Materialize) {
+    std::optional<Student> john = store.materialize(1000);
+    ASSERT_TRUE(john.has_value());
+    EXPECT_EQ(john->getName(), "John Doe");
+    EXPECT_EQ(john->getEmail(), "john.doe@example.com");
+    EXPECT_EQ(john->getAge(), 20);
+    EXPECT_EQ(john->getCourses(), (std::vector<std::string>{"CS101", "MATH202"}));
+    EXPECT_EQ(store.getName(1001), "Jane Smith");
+    EXPECT_FALSE(store.materialize(999).has_value());
+    EXPECT_TRUE(store.getName(999).empty());
+}
+
+// Test deleting, replacing and updating courses
+TEST_F(ColumnarStudentStoreTest, Mutations) {
+    EXPECT_TRUE(store.erase(1001));
+    EXPECT_FALSE(store.erase(1001));
+    EXPECT_EQ(store.filterByAgeRange(0, 100), (std::vector<uint32_t>{1000, 1002}));
+    
+    // Replacing moves the row to the end; results stay in ID order
+    store.upsert(Student(1000, "John Updated", "john@example.com", 30));
+    EXPECT_EQ(store.filterByAgeRange(0, 100), (std::vector<uint32_t>{1000, 1002}));
+    EXPECT_EQ(store.filterByAgeRange(30, 30), (std::vector<uint32_t>{1000}));
+    EXPECT_EQ(store.getName(1000), "John Updated");
+    
+    Student bob(1002, "Bob Johnson", "bob.johnson@example.com", 19);
+    bob.addCourse("PHYSICS101");
+    store.updateCourses(bob);
+    EXPECT_EQ(store.materialize(1002)->getCourses(), (std::vector<std::string>{"PHYSICS101"}));
+    
+    store.clear();
+    EXPECT_EQ(store.size(), 0);
+    EXPECT_TRUE(store.filterByIdRange(0, 5000).empty());
+}
+
+// Test random mutations, including compaction, against a std::map reference
+TEST_F(ColumnarStudentStoreTest, MatchesReference) {
+    std::map<uint32_t, int> reference = {{1000, 20}, {1001, 22}, {1002, 19}};
+    std::mt19937 rng(3);
+    for (int step = 0; step < 50000; ++step) {
+        uint32_t id = 900 + rng() % 5000;
+        if (rng() % 2 == 0) {
+            EXPECT_EQ(store.erase(id), reference.erase(id) > 0);
+        } else {
+            int age = 17 + static_cast<int>(rng() % 20);
+            Student student(static_cast<int>(id), "Student", "s@example.com", age);
+            student.addCourse("COURSE" + std::to_string(rng() % 10));
+            store.upsert(student);
+            reference[id] = age;
+        }
+    }
+    
+    std::vector<uint32_t> expected;
+    for (const auto& pair : reference) {
+        if (pair.second >= 20 && pair.second <= 25) {
+            expected.push_back(pair.first);
+        }
+    }
+    EXPECT_EQ(store.size(), reference.size());
+    EXPECT_EQ(store.filterByAgeRange(20, 25), expected);
+    EXPECT_EQ(store.countByAgeRange(20, 25), expected.size());
+    
+    std::vector<uint32_t> idRange;
+    for (auto it = reference.lower_bound(2000); it != reference.end() && it->first <= 3000; ++it) {
+        idRange.push_back(it->first);
+    }
+    EXPECT_EQ(store.filterByIdRange(2000, 3000), idRange);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include "CourseDictionary.h"
+#include "Student.h"
+#include <string>
+#include <thread>
+#include <vector>
+
+// Test fixture for CourseDictionary class
+class CourseDictionaryTest : public ::testing::Test {
+protected:
+    CourseDictionary& dictionary = CourseDictionary::instance();
+};
+
+// Test that a name always maps to the same ID and back
+TEST_F(CourseDictionaryTest, InternIsStable) {
+    uint32_t cs = dictionary.intern("DICT_CS101");
+    uint32_t math = dictionary.intern("DICT_MATH202");
+    EXPECT_NE(cs, math);
+    EXPECT_EQ(dictionary.intern(std::string("DICT_CS101")), cs);
+    EXPECT_EQ(dictionary.name(cs), "DICT_CS101");
+    EXPECT_EQ(dictionary.name(math), "DICT_MATH202");
+    EXPECT_EQ(dictionary.find("DICT_CS101"), cs);
+}
+
+// Test that lookups do not add names
+TEST_F(CourseDictionaryTest, FindDoesNotIntern) {
+    size_t before = dictionary.size();
+    EXPECT_FALSE(dictionary.find("DICT_NEVER_ENROLLED").has_value());
+    EXPECT_EQ(dictionary.size(), before);
+
+    Student student(1, "John", "j@x.com", 20);
+    student.removeCourse("DICT_NEVER_ENROLLED");
+    EXPECT_FALSE(student.isEnrolledIn("DICT_NEVER_ENROLLED"));
+    EXPECT_EQ(dictionary.size(), before);
+}
+
+// Test that unknown IDs resolve to an empty name
+TEST_F(CourseDictionaryTest, UnknownId) {
+    EXPECT_TRUE(dictionary.name(static_cast<uint32_t>(dictionary.size()) + 100).empty());
+}
+
+// Test that references stay valid while the table grows
+TEST_F(CourseDictionaryTest, NamesDoNotMove) {
+    const std::string& name = dictionary.name(dictionary.intern("DICT_STABLE"));
+    for (int i = 0; i < 1000; ++i) {
+        dictionary.intern("DICT_GROW" + std::to_string(i));
+    }
+    EXPECT_EQ(name, "DICT_STABLE");
+    EXPECT_EQ(&name, &dictionary.name(*dictionary.find("DICT_STABLE")));
+}
+
+// Test that concurrent interning hands out one ID per name
+TEST_F(CourseDictionaryTest, ConcurrentIntern) {
+    const int threadCount = 8;
+    const int courseCount = 500;
+    std::vector<std::vector<uint32_t>> seen(threadCount);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&seen, t, this] {
+            for (int i = 0; i < courseCount; ++i) {
+                seen[t].push_back(dictionary.intern("DICT_PARALLEL" + std::to_string(i)));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (int t = 1; t < threadCount; ++t) {
+        EXPECT_EQ(seen[t], seen[0]);
+    }
+    for (int i = 0; i < courseCount; ++i) {
+        EXPECT_EQ(dictionary.name(seen[0][i]), "DICT_PARALLEL" + std::to_string(i));
+    }
+}
+
+// Test that students share IDs and keep names at the interface
+TEST_F(CourseDictionaryTest, StudentsShareIds) {
+    Student a(1, "John", "j@x.com", 20);
+    Student b(2, "Jane", "j@y.com", 21);
+    a.addCourse("DICT_SHARED");
+    b.addCourse("DICT_SHARED");
+    b.addCourseId(dictionary.intern("DICT_OTHER"));
+    EXPECT_EQ(a.getCourseIds(), (std::vector<uint32_t>{dictionary.intern("DICT_SHARED")}));
+    EXPECT_EQ(b.getCourseIds()[0], a.getCourseIds()[0]);
+    EXPECT_EQ(b.getCourses(), (std::vector<std::string>{"DICT_SHARED", "DICT_OTHER"}));
+    EXPECT_TRUE(b.isEnrolledInCourseId(*dictionary.find("DICT_OTHER")));
+    b.removeCourse("DICT_SHARED");
+    EXPECT_EQ(b.getCourses(), (std::vector<std::string>{"DICT_OTHER"}));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
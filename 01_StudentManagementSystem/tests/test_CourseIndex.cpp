@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include "CourseIndex.h"
+
+// Test fixture for CourseIndex class
+class CourseIndexTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        index.add(0, 1002);
+        index.add(0, 1000);
+        index.add(0, 1001);
+        index.add(3, 1000);
+    }
+
+    CourseIndex index;
+};
+
+// Test that posting lists are sorted and free of duplicates
+TEST_F(CourseIndexTest, PostingsAreSorted) {
+    index.add(0, 1001);
+    EXPECT_EQ(index.students(0).toVector(), (std::vector<uint32_t>{1000, 1001, 1002}));
+    EXPECT_EQ(index.students(3).toVector(), (std::vector<uint32_t>{1000}));
+    EXPECT_EQ(index.count(0), 3);
+}
+
+// Test courses without students
+TEST_F(CourseIndexTest, EmptyCourses) {
+    EXPECT_TRUE(index.students(1).empty());
+    EXPECT_TRUE(index.students(100).empty());
+    EXPECT_EQ(index.count(100), 0);
+    index.remove(100, 1000);
+    index.remove(1, 1000);
+}
+
+// Test removing single enrollments and whole students
+TEST_F(CourseIndexTest, Remove) {
+    index.remove(0, 1001);
+    index.remove(0, 1005);
+    EXPECT_EQ(index.students(0).toVector(), (std::vector<uint32_t>{1000, 1002}));
+
+    index.removeStudent(1000, {0, 3});
+    EXPECT_EQ(index.students(0).toVector(), (std::vector<uint32_t>{1002}));
+    EXPECT_TRUE(index.students(3).empty());
+
+    index.addStudent(999, {0, 3});
+    EXPECT_EQ(index.students(0).toVector(), (std::vector<uint32_t>{999, 1002}));
+    index.clear();
+    EXPECT_EQ(index.count(0), 0);
+}
+
+// Test intersections and unions over several courses
+TEST_F(CourseIndexTest, MatchAllAndAny) {
+    index.add(3, 1002);
+    index.add(5, 1002);
+    EXPECT_EQ(index.matchAll({0, 3}).toVector(), (std::vector<uint32_t>{1000, 1002}));
+    EXPECT_EQ(index.matchAll({0, 3, 5}).toVector(), (std::vector<uint32_t>{1002}));
+    EXPECT_TRUE(index.matchAll({0, 7}).empty());
+    EXPECT_TRUE(index.matchAll({}).empty());
+    EXPECT_EQ(index.matchAny({3, 5, 7}).toVector(), (std::vector<uint32_t>{1000, 1002}));
+    EXPECT_TRUE(index.matchAny({}).empty());
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+#include "CsvParser.h"
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <cstdio>  // for remove()
+
+// Reference implementation: the getline/stringstream reader FileManager used before CsvParser
+static std::vector<Student> legacyParse(const std::string& content) {
+    std::vector<Student> students;
+    std::stringstream inFile(content);
+    std::string line;
+    while (std::getline(inFile, line)) {
+        std::stringstream ss(line);
+        std::string token;
+        std::getline(ss, token, ',');
+        int studentId = std::stoi(token);
+        std::getline(ss, token, ',');
+        std::string name = token;
+        std::getline(ss, token, ',');
+        std::string email = token;
+        std::getline(ss, token, ',');
+        int age = std::stoi(token);
+        Student student(studentId, name, email, age);
+        while (std::getline(ss, token, ',')) {
+            student.addCourse(token);
+        }
+        students.push_back(student);
+    }
+    return students;
+}
+
+static void expectSameStudents(const std::vector<Student>& actual, const std::vector<Student>& expected) {
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(actual[i].getStudentId(), expected[i].getStudentId());
+        EXPECT_EQ(actual[i].getName(), expected[i].getName());
+        EXPECT_EQ(actual[i].getEmail(), expected[i].getEmail());
+        EXPECT_EQ(actual[i].getAge(), expected[i].getAge());
+        EXPECT_EQ(actual[i].getCourses(), expected[i].getCourses());
+    }
+}
+
+// Test fixture for CsvParser class
+class CsvParserTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // One file per test, so tests run in parallel by ctest do not clash
+        const std::string testName = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        testFilePath = "test_csv_parser_" + testName + ".dat";
+    }
+
+    void TearDown() override {
+        std::remove(testFilePath.c_str());
+    }
+
+    void writeFile(const std::string& content) {
+        std::ofstream outFile(testFilePath, std::ios::binary);
+        outFile << content;
+    }
+
+    std::string testFilePath;
+};
+
+// Test parsing a single record
+TEST_F(CsvParserTest, ParseLine) {
+    Student student = CsvParser::parseLine("1001,John Doe,john.doe@example.com,20,CS101,MATH202");
+    EXPECT_EQ(student.getStudentId(), 1001);
+    EXPECT_EQ(student.getName(), "John Doe");
+    EXPECT_EQ(student.getEmail(), "john.doe@example.com");
+    EXPECT_EQ(student.getAge(), 20);
+    ASSERT_EQ(student.getCourses().size(), 2);
+    EXPECT_TRUE(student.isEnrolledIn("CS101"));
+    EXPECT_TRUE(student.isEnrolledIn("MATH202"));
+}
+
+// Test course field edge cases
+TEST_F(CsvParserTest, CourseFields) {
+    // No courses, with and without a trailing comma
+    EXPECT_TRUE(CsvParser::parseLine("1001,John,j@x.com,20").getCourses().empty());
+    EXPECT_TRUE(CsvParser::parseLine("1001,John,j@x.com,20,").getCourses().empty());
+
+    // Duplicate courses are stored once
+    EXPECT_EQ(CsvParser::parseLine("1001,John,j@x.com,20,CS101,CS101").getCourses().size(), 1);
+
+    // Empty course in the middle is kept, trailing empty field is dropped
+    std::vector<std::string> courses = CsvParser::parseLine("1001,John,j@x.com,20,A,,B,").getCourses();
+    EXPECT_EQ(courses, (std::vector<std::string>{"A", "", "B"}));
+}
+
+// Test numeric fields follow std::stoi rules
+TEST_F(CsvParserTest, NumericFields) {
+    EXPECT_EQ(CsvParser::parseLine(" +1001,John,j@x.com,20\r").getStudentId(), 1001);
+    EXPECT_EQ(CsvParser::parseLine("1001,John,j@x.com, 20 years").getAge(), 20);
+    EXPECT_THROW(CsvParser::parseLine("abc,John,j@x.com,20"), std::invalid_argument);
+    EXPECT_THROW(CsvParser::parseLine("99999999999,John,j@x.com,20"), std::out_of_range);
+    EXPECT_THROW(CsvParser::parseLine(""), std::invalid_argument);
+    EXPECT_THROW(CsvParser::parseLine("1001,John"), std::invalid_argument);
+}
+
+// Test buffer parsing with and without a final newline
+TEST_F(CsvParserTest, ParseBuffer) {
+    std::vector<Student> students;
+    CsvParser::parseBuffer("1001,John,j@x.com,20,CS101\n1002,Jane,jane@x.com,22\n", students);
+    EXPECT_EQ(students.size(), 2);
+
+    students.clear();
+    CsvParser::parseBuffer("1001,John,j@x.com,20\n1002,Jane,jane@x.com,22", students);
+    ASSERT_EQ(students.size(), 2);
+    EXPECT_EQ(students[1].getName(), "Jane");
+}
+
+// Test the block reader matches the legacy reader, including lines spanning blocks
+TEST_F(CsvParserTest, ParseFileMatchesLegacyReader) {
+    std::string content;
+    for (int i = 0; i < 200; ++i) {
+        content += std::to_string(1000 + i) + ",Student " + std::to_string(i) + ",s" +
+                   std::to_string(i) + "@example.com," + std::to_string(18 + i % 10);
+        for (int c = 0; c < i % 4; ++c) {
+            content += ",COURSE" + std::to_string(c);
+        }
+        content += (i % 7 == 0) ? ",\n" : "\n";
+    }
+    content += "1200,Last Student,last@example.com,30,A,,B";
+    writeFile(content);
+
+    std::vector<Student> expected = legacyParse(content);
+
+    // Block sizes smaller than a line force the buffer to grow
+    for (size_t blockSize : {size_t(7), size_t(64), size_t(4096), CsvParser::DEFAULT_BLOCK_SIZE}) {
+        std::vector<Student> students;
+        CsvParser parser(blockSize);
+        ASSERT_TRUE(parser.parseFile(testFilePath, students));
+        expectSameStudents(students, expected);
+    }
+}
+
+// Test range boundaries always start at a record
+TEST_F(CsvParserTest, SplitRanges) {
+    std::string content;
+    for (int i = 0; i < 100; ++i) {
+        content += std::to_string(1000 + i) + ",Student " + std::to_string(i) + ",s@x.com,20\n";
+    }
+    writeFile(content);
+
+    std::vector<std::uint64_t> bounds = CsvParser::splitRanges(testFilePath, 8);
+    ASSERT_GE(bounds.size(), 2);
+    EXPECT_EQ(bounds.front(), 0);
+    EXPECT_EQ(bounds.back(), content.size());
+    for (size_t i = 1; i + 1 < bounds.size(); ++i) {
+        EXPECT_LT(bounds[i - 1], bounds[i]);
+        EXPECT_EQ(content[bounds[i] - 1], '\n');
+    }
+
+    // A single record cannot be split
+    writeFile("1001,John,j@x.com,20");
+    EXPECT_EQ(CsvParser::splitRanges(testFilePath, 4), (std::vector<std::uint64_t>{0, 20}));
+}
+
+// Test the parallel reader returns the same records in the same order
+TEST_F(CsvParserTest, ParseFileParallel) {
+    std::string content;
+    for (int i = 0; i < 1000; ++i) {
+        content += std::to_string(1000 + i) + ",Student " + std::to_string(i) + ",s" +
+                   std::to_string(i) + "@example.com,20,CS" + std::to_string(i % 3) + "\n";
+    }
+    content += "2000,No Newline,nl@example.com,21";
+    writeFile(content);
+
+    std::vector<Student> expected = legacyParse(content);
+    for (unsigned threads : {1u, 2u, 3u, 8u, 64u}) {
+        std::vector<Student> students;
+        CsvParser parser(256);
+        ASSERT_TRUE(parser.parseFileParallel(testFilePath, threads, students));
+        expectSameStudents(students, expected);
+    }
+}
+
+// Test parse errors on worker threads reach the caller
+TEST_F(CsvParserTest, ParseFileParallelPropagatesErrors) {
+    std::string content;
+    for (int i = 0; i < 100; ++i) {
+        content += std::to_string(1000 + i) + ",Student,s@x.com,20\n";
+    }
+    content += "bad,Student,s@x.com,20\n";
+    writeFile(content);
+
+    std::vector<Student> students;
+    CsvParser parser;
+    EXPECT_THROW(parser.parseFileParallel(testFilePath, 4, students), std::invalid_argument);
+}
+
+// Test parsing a missing file
+TEST_F(CsvParserTest, ParseMissingFile) {
+    std::vector<Student> students;
+    CsvParser parser;
+    EXPECT_FALSE(parser.parseFile("does_not_exist.dat", students));
+    EXPECT_FALSE(parser.parseFileParallel("does_not_exist.dat", 4, students));
+    EXPECT_TRUE(students.empty());
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
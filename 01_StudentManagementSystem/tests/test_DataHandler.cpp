@@ -9,8 +9,10 @@
 class DataHandlerTest : public ::testing::Test {
 protected:
     void SetUp() override {
+        // One file per test, so tests run in parallel by ctest do not clash
+        const std::string testName = ::testing::UnitTest::GetInstance()->current_test_info()->name();
         // Use a temporary test file
-        testFilePath = "test_data_handler.dat";
+        testFilePath = "test_data_handler_" + testName + ".dat";
         
         // Initialize managers
         fileManager = new FileManager(testFilePath);
@@ -35,8 +37,10 @@ protected:
         delete fileManager;
         delete studentManager;
         
-        // Clean up temporary test file
+        // Clean up temporary test files
         std::remove(testFilePath.c_str());
+        std::remove((testFilePath + ".snap").c_str());
+        std::remove((testFilePath + ".journal").c_str());
     }
 
     std::string testFilePath;
@@ -124,6 +128,79 @@ TEST_F(DataHandlerTest, DataPersistence) {
     EXPECT_EQ(students[0]->getName(), "Alice Brown");
 }
 
+// Test loading keeps the IDs stored in the file
+TEST_F(DataHandlerTest, LoadDataPreservesIds) {
+    // Leave a gap in the IDs before saving
+    studentManager->deleteStudent(testStudentId);
+    studentManager->addStudent("Alice Brown", "alice.brown@example.com", 21);
+    std::vector<Student> saved = studentManager->getAllStudents();
+    saveData(*studentManager, *fileManager);
+    
+    StudentManager newManager;
+    loadData(newManager, *fileManager);
+    
+    std::vector<Student> loaded = newManager.getAllStudents();
+    ASSERT_EQ(loaded.size(), saved.size());
+    for (size_t i = 0; i < saved.size(); ++i) {
+        EXPECT_EQ(loaded[i].getStudentId(), saved[i].getStudentId());
+        EXPECT_EQ(loaded[i].getName(), saved[i].getName());
+    }
+    EXPECT_EQ(newManager.getStudent(testStudentId), nullptr);
+}
+
+// Test journaled saves and restart through snapshot load plus journal replay
+TEST_F(DataHandlerTest, JournalSaveAndReplay) {
+    std::string journalPath = testFilePath + ".journal";
+    saveData(*studentManager, *fileManager);
+    
+    {
+        StudentManager manager1;
+        Journal journal(journalPath);
+        ::testing::internal::CaptureStdout();
+        loadData(manager1, *fileManager, journal);
+        
+        // Changes are only appended to the journal
+        manager1.addStudent("Alice Brown", "alice.brown@example.com", 21);
+        manager1.enrollStudentInCourse(testStudentId, "PHYSICS101");
+        saveData(manager1, *fileManager, journal);
+        std::string output = ::testing::internal::GetCapturedStdout();
+        EXPECT_NE(output.find("Data saved successfully"), std::string::npos);
+        EXPECT_EQ(journal.getPendingRecordCount(), 0);
+        EXPECT_FALSE(fileManager->snapshotExists());
+    }
+    
+    // The CSV file still holds the old state, the journal the changes
+    StudentManager manager2;
+    Journal journal(journalPath);
+    ::testing::internal::CaptureStdout();
+    loadData(manager2, *fileManager, journal);
+    std::string output = ::testing::internal::GetCapturedStdout();
+    EXPECT_NE(output.find("Replayed 2 journal records"), std::string::npos);
+    EXPECT_EQ(manager2.getStudentCount(), 3);
+    ASSERT_NE(manager2.getStudent(testStudentId), nullptr);
+    EXPECT_TRUE(manager2.getStudent(testStudentId)->isEnrolledIn("PHYSICS101"));
+    EXPECT_EQ(manager2.getJournal(), &journal);
+    
+    // A checkpoint moves everything into the snapshot and empties the journal
+    ::testing::internal::CaptureStdout();
+    checkpointData(manager2, *fileManager, journal);
+    ::testing::internal::GetCapturedStdout();
+    EXPECT_TRUE(fileManager->snapshotExists());
+    EXPECT_EQ(journal.getRecordCount(), 0);
+    manager2.deleteStudent(testStudentId);
+    journal.sync();
+    
+    StudentManager manager3;
+    Journal journal3(journalPath);
+    ::testing::internal::CaptureStdout();
+    loadData(manager3, *fileManager, journal3);
+    output = ::testing::internal::GetCapturedStdout();
+    EXPECT_NE(output.find("Loaded 3 students"), std::string::npos);
+    EXPECT_NE(output.find("Replayed 1 journal records"), std::string::npos);
+    EXPECT_EQ(manager3.getStudentCount(), 2);
+    EXPECT_EQ(manager3.getStudent(testStudentId), nullptr);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
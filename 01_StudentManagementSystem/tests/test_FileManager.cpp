@@ -1,14 +1,20 @@
 #include <gtest/gtest.h>
 #include "FileManager.h"
+#include "StudentManager.h"
+#include <atomic>
 #include <fstream>
+#include <string>
+#include <thread>
 #include <cstdio>  // for remove()
 
 // Test fixture for FileManager class
 class FileManagerTest : public ::testing::Test {
 protected:
     void SetUp() override {
+        // One file per test, so tests run in parallel by ctest do not clash
+        const std::string testName = ::testing::UnitTest::GetInstance()->current_test_info()->name();
         // Use a temporary test file
-        testFilePath = "test_students.dat";
+        testFilePath = "test_students_" + testName + ".dat";
         
         // Create test students
         testStudents.push_back(Student(1001, "John Doe", "john.doe@example.com", 20));
@@ -26,8 +32,9 @@ protected:
     void TearDown() override {
         delete fileManager;
         
-        // Clean up temporary test file
+        // Clean up temporary test files
         std::remove(testFilePath.c_str());
+        std::remove((testFilePath + ".snap").c_str());
     }
 
     std::string testFilePath;
@@ -90,6 +97,170 @@ TEST_F(FileManagerTest, SaveAndLoadStudents) {
     EXPECT_TRUE(loadedStudents[1].isEnrolledIn("PHYSICS101"));
 }
 
+// Test multi-threaded loading of a large file
+TEST_F(FileManagerTest, LoadStudentsWithThreads) {
+    // Write enough records for the file to be split between threads
+    std::vector<Student> manyStudents;
+    for (int i = 0; i < 150000; ++i) {
+        manyStudents.push_back(Student(1000 + i, "Student " + std::to_string(i),
+                                       "student" + std::to_string(i) + "@example.com", 18 + i % 10));
+        manyStudents.back().addCourse("CS" + std::to_string(i % 5));
+    }
+    ASSERT_TRUE(fileManager->saveStudents(manyStudents));
+
+    fileManager->setLoadThreadCount(4);
+    EXPECT_EQ(fileManager->getLoadThreadCount(), 4);
+    std::vector<Student> loadedStudents = fileManager->loadStudents();
+
+    ASSERT_EQ(loadedStudents.size(), manyStudents.size());
+    for (size_t i = 0; i < manyStudents.size(); i += 997) {
+        EXPECT_EQ(loadedStudents[i].getStudentId(), manyStudents[i].getStudentId());
+        EXPECT_EQ(loadedStudents[i].getName(), manyStudents[i].getName());
+        EXPECT_EQ(loadedStudents[i].getCourses(), manyStudents[i].getCourses());
+    }
+    EXPECT_EQ(loadedStudents.back().getStudentId(), manyStudents.back().getStudentId());
+}
+
+// Test saving and loading a binary snapshot
+TEST_F(FileManagerTest, SaveAndLoadSnapshot) {
+    EXPECT_FALSE(fileManager->snapshotExists());
+    EXPECT_EQ(fileManager->getSnapshotPath(), testFilePath + ".snap");
+    
+    ASSERT_TRUE(fileManager->saveSnapshot(testStudents));
+    EXPECT_TRUE(fileManager->snapshotExists());
+    
+    std::vector<Student> loadedStudents = fileManager->loadSnapshot();
+    ASSERT_EQ(loadedStudents.size(), 2);
+    EXPECT_EQ(loadedStudents[0].getStudentId(), 1001);
+    EXPECT_EQ(loadedStudents[0].getName(), "John Doe");
+    EXPECT_EQ(loadedStudents[0].getEmail(), "john.doe@example.com");
+    EXPECT_EQ(loadedStudents[0].getAge(), 20);
+    EXPECT_EQ(loadedStudents[0].getCourses(), testStudents[0].getCourses());
+    EXPECT_EQ(loadedStudents[1].getName(), "Jane Smith");
+    EXPECT_TRUE(loadedStudents[1].isEnrolledIn("PHYSICS101"));
+}
+
+// Test saving straight from a StudentManager, as text and as a snapshot
+TEST_F(FileManagerTest, SaveFromManager) {
+    StudentManager manager;
+    manager.bulkLoadStudents(std::vector<Student>(testStudents));
+    
+    ASSERT_TRUE(fileManager->saveStudents(manager));
+    std::vector<Student> loadedStudents = fileManager->loadStudents();
+    ASSERT_EQ(loadedStudents.size(), 2);
+    for (size_t i = 0; i < loadedStudents.size(); ++i) {
+        EXPECT_EQ(loadedStudents[i].toString(), testStudents[i].toString());
+    }
+    
+    ASSERT_TRUE(fileManager->saveSnapshot(manager));
+    loadedStudents = fileManager->loadSnapshot();
+    ASSERT_EQ(loadedStudents.size(), 2);
+    for (size_t i = 0; i < loadedStudents.size(); ++i) {
+        EXPECT_EQ(loadedStudents[i].toString(), testStudents[i].toString());
+    }
+    
+    // With versions the snapshot file is written from a point-in-time view
+    manager.setSnapshotsEnabled(true);
+    StudentSnapshot view = manager.snapshot();
+    manager.addStudent("Later Student", "later@example.com", 30);
+    ASSERT_TRUE(fileManager->saveSnapshot(view));
+    EXPECT_EQ(fileManager->loadSnapshot().size(), 2);
+    ASSERT_TRUE(fileManager->saveSnapshot(manager));
+    EXPECT_EQ(fileManager->loadSnapshot().size(), 3);
+}
+
+// Test saving a snapshot while another thread deletes and re-adds students
+TEST_F(FileManagerTest, SaveSnapshotWhileMutating) {
+    StudentManager manager;
+    for (int i = 0; i < 500; ++i) {
+        manager.addStudent("Student " + std::to_string(i), "student@example.com", 20);
+    }
+    
+    std::atomic<bool> done{false};
+    std::thread writer([&manager, &done] {
+        for (uint32_t round = 0; !done.load(); ++round) {
+            uint32_t id = 1000 + round % 500;
+            manager.deleteStudent(id);
+            manager.addStudent("Replacement with a long name " + std::to_string(round),
+                               "replacement@example.com", 21);
+        }
+    });
+    for (int i = 0; i < 20; ++i) {
+        ASSERT_TRUE(fileManager->saveSnapshot(manager));
+    }
+    done = true;
+    writer.join();
+    
+    for (const Student& student : fileManager->loadSnapshot()) {
+        EXPECT_NE(student.getName().find(' '), std::string::npos);
+    }
+}
+
+// Test loading a snapshot that is not a snapshot
+TEST_F(FileManagerTest, LoadInvalidSnapshot) {
+    std::ofstream(testFilePath + ".snap") << "not a snapshot";
+    ::testing::internal::CaptureStderr();
+    std::vector<Student> loadedStudents = fileManager->loadSnapshot();
+    ::testing::internal::GetCapturedStderr();
+    EXPECT_TRUE(loadedStudents.empty());
+}
+
+// Test serving lookups from a memory-mapped snapshot
+TEST_F(FileManagerTest, MappedSnapshotLookups) {
+    // Nothing is served before a snapshot is mapped
+    EXPECT_FALSE(fileManager->isSnapshotMapped());
+    EXPECT_FALSE(fileManager->getStudent(1001).has_value());
+    
+    ::testing::internal::CaptureStderr();
+    EXPECT_FALSE(fileManager->mapSnapshot());
+    ::testing::internal::GetCapturedStderr();
+    
+    ASSERT_TRUE(fileManager->saveSnapshot(testStudents));
+    ASSERT_TRUE(fileManager->mapSnapshot());
+    EXPECT_TRUE(fileManager->isSnapshotMapped());
+    EXPECT_EQ(fileManager->getMappedStudentCount(), 2);
+    
+    std::optional<Student> student = fileManager->getStudent(1002);
+    ASSERT_TRUE(student.has_value());
+    EXPECT_EQ(student->getName(), "Jane Smith");
+    EXPECT_EQ(student->getEmail(), "jane.smith@example.com");
+    EXPECT_TRUE(student->isEnrolledIn("PHYSICS101"));
+    EXPECT_FALSE(fileManager->getStudent(9999).has_value());
+    
+    // Case-insensitive substring search, same rules as StudentManager
+    EXPECT_EQ(fileManager->searchStudentIdsByName("JANE"), (std::vector<uint32_t>{1002}));
+    EXPECT_EQ(fileManager->searchStudentIdsByName("o"), (std::vector<uint32_t>{1001}));
+    EXPECT_EQ(fileManager->searchStudentIdsByName("").size(), 2);
+    EXPECT_TRUE(fileManager->searchStudentIdsByName("Xavier").empty());
+    
+    std::vector<Student> students = fileManager->searchStudentsByName("doe");
+    ASSERT_EQ(students.size(), 1);
+    EXPECT_EQ(students[0].getStudentId(), 1001);
+    EXPECT_EQ(students[0].getCourses().size(), 2);
+    
+    fileManager->unmapSnapshot();
+    EXPECT_FALSE(fileManager->isSnapshotMapped());
+    EXPECT_EQ(fileManager->getMappedStudentCount(), 0);
+    EXPECT_TRUE(fileManager->searchStudentIdsByName("Jane").empty());
+}
+
+// Test converting between the CSV file and the snapshot
+TEST_F(FileManagerTest, ConvertBetweenCsvAndSnapshot) {
+    ASSERT_TRUE(fileManager->saveStudents(testStudents));
+    ASSERT_TRUE(fileManager->convertCsvToSnapshot());
+    
+    // Replace the CSV file and restore it from the snapshot
+    fileManager->createEmptyFile();
+    EXPECT_TRUE(fileManager->loadStudents().empty());
+    ASSERT_TRUE(fileManager->convertSnapshotToCsv());
+    
+    std::vector<Student> loadedStudents = fileManager->loadStudents();
+    ASSERT_EQ(loadedStudents.size(), 2);
+    EXPECT_EQ(loadedStudents[0].getStudentId(), 1001);
+    EXPECT_EQ(loadedStudents[1].getStudentId(), 1002);
+    EXPECT_EQ(loadedStudents[0].getCourses(), testStudents[0].getCourses());
+}
+
 // Test loading from non-existent file
 TEST_F(FileManagerTest, LoadFromNonExistentFile) {
     // File does not exist yet
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include "FileSync.h"
+#include <cstdio>  // for remove()
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+// Test fixture for the file sync helpers
+class FileSyncTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // One file per test, so tests run in parallel by ctest do not clash
+        const std::string testName = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        testFilePath = "test_file_sync_" + testName + ".dat";
+        tempPath = testFilePath + ".tmp";
+    }
+
+    void TearDown() override {
+        std::remove(testFilePath.c_str());
+        std::remove(tempPath.c_str());
+    }
+
+    static std::string readFile(const std::string& path) {
+        std::ifstream inFile(path, std::ios::binary);
+        std::stringstream contents;
+        contents << inFile.rdbuf();
+        return contents.str();
+    }
+
+    std::string testFilePath;
+    std::string tempPath;
+};
+
+// Test syncing files and directories
+TEST_F(FileSyncTest, SyncFileAndDirectory) {
+    std::ofstream(testFilePath) << "data";
+    EXPECT_TRUE(syncFile(testFilePath));
+    EXPECT_TRUE(syncParentDirectory(testFilePath));
+    EXPECT_TRUE(syncParentDirectory(std::filesystem::absolute(testFilePath).string()));
+    EXPECT_FALSE(syncFile("no_such_file.dat"));
+    EXPECT_FALSE(syncParentDirectory("no_such_directory/file.dat"));
+}
+
+// Test replacing a file with a temporary file
+TEST_F(FileSyncTest, ReplaceFileDurably) {
+    std::ofstream(testFilePath) << "old";
+    std::ofstream(tempPath) << "new";
+    ASSERT_TRUE(replaceFileDurably(tempPath, testFilePath));
+    EXPECT_EQ(readFile(testFilePath), "new");
+    EXPECT_FALSE(std::filesystem::exists(tempPath));
+
+    // A missing temporary file leaves the target alone
+    EXPECT_FALSE(replaceFileDurably(tempPath, testFilePath));
+    EXPECT_EQ(readFile(testFilePath), "new");
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
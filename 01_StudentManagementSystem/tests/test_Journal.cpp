@@ -0,0 +1,383 @@
+#include <gtest/gtest.h>
+#include "Journal.h"
+#include "StudentManager.h"
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <vector>
+#include <cstdio>  // for remove()
+
+// Test fixture for Journal class
+class JournalTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // One file per test, so tests run in parallel by ctest do not clash
+        const std::string testName = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        // Use a temporary journal file
+        testFilePath = "test_students_" + testName + ".journal";
+        std::remove(testFilePath.c_str());
+    }
+
+    void TearDown() override {
+        // Clean up temporary journal file
+        std::remove(testFilePath.c_str());
+    }
+
+    std::string testFilePath;
+};
+
+// Test that mutations on an attached manager are replayed into a new manager
+TEST_F(JournalTest, RecordAndReplay) {
+    {
+        Journal journal(testFilePath);
+        ASSERT_TRUE(journal.open());
+        
+        StudentManager manager;
+        manager.setJournal(&journal);
+        manager.addStudent("John Doe", "john.doe@example.com", 20);
+        manager.addStudent("Jane Smith", "jane.smith@example.com", 22);
+        manager.addStudent("Bob Johnson", "bob.johnson@example.com", 19);
+        manager.enrollStudentInCourse(1000, "CS101");
+        manager.enrollStudentInCourse(1000, "MATH202");
+        manager.removeStudentFromCourse(1000, "CS101");
+        manager.deleteStudent(1001);
+        
+        // Failed operations are not recorded
+        manager.deleteStudent(9999);
+        manager.enrollStudentInCourse(9999, "CS101");
+        
+        EXPECT_EQ(journal.getRecordCount(), 7);
+        EXPECT_EQ(journal.getPendingRecordCount(), 7);
+        ASSERT_TRUE(journal.sync());
+        EXPECT_EQ(journal.getPendingRecordCount(), 0);
+    }
+    
+    Journal journal(testFilePath);
+    StudentManager restored;
+    EXPECT_EQ(journal.replay(restored), 7);
+    EXPECT_EQ(journal.getRecordCount(), 7);
+    
+    EXPECT_EQ(restored.getStudentCount(), 2);
+    Student* student = restored.getStudent(1000);
+    ASSERT_NE(student, nullptr);
+    EXPECT_EQ(student->getName(), "John Doe");
+    EXPECT_FALSE(student->isEnrolledIn("CS101"));
+    EXPECT_TRUE(student->isEnrolledIn("MATH202"));
+    EXPECT_EQ(restored.getStudent(1001), nullptr);
+    ASSERT_NE(restored.getStudent(1002), nullptr);
+    
+    // Replay keeps IDs, so new students continue after them
+    restored.addStudent("Alice Brown", "alice.brown@example.com", 21);
+    EXPECT_NE(restored.getStudent(1003), nullptr);
+}
+
+// Test that replaying does not append to the manager's own journal
+TEST_F(JournalTest, ReplayDoesNotRecordAgain) {
+    {
+        Journal journal(testFilePath);
+        ASSERT_TRUE(journal.open());
+        StudentManager manager;
+        manager.setJournal(&journal);
+        manager.addStudent("John Doe", "john.doe@example.com", 20);
+    }
+    
+    Journal journal(testFilePath);
+    StudentManager manager;
+    manager.setJournal(&journal);
+    EXPECT_EQ(journal.replay(manager), 1);
+    EXPECT_EQ(journal.getPendingRecordCount(), 0);
+    EXPECT_EQ(manager.getJournal(), &journal);
+}
+
+// Test that records which were never synced are lost and a torn tail is discarded
+TEST_F(JournalTest, TornTailIsDiscarded) {
+    {
+        Journal journal(testFilePath);
+        ASSERT_TRUE(journal.open());
+        StudentManager manager;
+        manager.setJournal(&journal);
+        manager.addStudent("John Doe", "john.doe@example.com", 20);
+        manager.addStudent("Jane Smith", "jane.smith@example.com", 22);
+        ASSERT_TRUE(journal.sync());
+    }
+    
+    // Simulate a crash in the middle of writing the next record
+    uintmax_t goodSize = std::filesystem::file_size(testFilePath);
+    {
+        std::ofstream outFile(testFilePath, std::ios::binary | std::ios::app);
+        outFile.write("\x20\x00\x00\x00\x01\x02", 6);
+    }
+    
+    Journal journal(testFilePath);
+    StudentManager manager;
+    ::testing::internal::CaptureStderr();
+    EXPECT_EQ(journal.replay(manager), 2);
+    ::testing::internal::GetCapturedStderr();
+    EXPECT_EQ(manager.getStudentCount(), 2);
+    EXPECT_EQ(std::filesystem::file_size(testFilePath), goodSize);
+    
+    // New records are appended after the last good one
+    ASSERT_TRUE(journal.open());
+    manager.setJournal(&journal);
+    manager.deleteStudent(1000);
+    ASSERT_TRUE(journal.sync());
+    
+    Journal reopened(testFilePath);
+    StudentManager restored;
+    EXPECT_EQ(reopened.replay(restored), 3);
+    EXPECT_EQ(restored.getStudentCount(), 1);
+}
+
+// Test resetting the journal after a checkpoint
+TEST_F(JournalTest, Reset) {
+    Journal journal(testFilePath);
+    ASSERT_TRUE(journal.open());
+    StudentManager manager;
+    manager.setJournal(&journal);
+    manager.addStudent("John Doe", "john.doe@example.com", 20);
+    ASSERT_TRUE(journal.sync());
+    
+    ASSERT_TRUE(journal.reset());
+    EXPECT_TRUE(journal.isOpen());
+    EXPECT_EQ(journal.getRecordCount(), 0);
+    
+    manager.addStudent("Jane Smith", "jane.smith@example.com", 22);
+    journal.close();
+    
+    Journal reopened(testFilePath);
+    StudentManager restored;
+    EXPECT_EQ(reopened.replay(restored), 1);
+    EXPECT_NE(restored.getStudent(1001), nullptr);
+    EXPECT_EQ(restored.getStudent(1000), nullptr);
+}
+
+// Test that records appended after a checkpoint's snapshot survive the reset
+TEST_F(JournalTest, ResetKeepsLaterRecords) {
+    Journal journal(testFilePath);
+    ASSERT_TRUE(journal.open());
+    StudentManager manager;
+    manager.setJournal(&journal);
+    manager.addStudent("John Doe", "john.doe@example.com", 20);
+    manager.enrollStudentInCourse(1000, "Math");
+    
+    uint64_t covered = 0;
+    StudentSnapshot view = manager.snapshot(covered);
+    EXPECT_EQ(covered, 2);
+    EXPECT_EQ(covered, journal.getAppendedSequence());
+    
+    // Written while the checkpoint is in progress; one stays pending
+    manager.addStudent("Jane Smith", "jane.smith@example.com", 22);
+    ASSERT_TRUE(journal.sync());
+    manager.enrollStudentInCourse(1001, "Physics");
+    
+    ASSERT_TRUE(journal.reset(covered));
+    EXPECT_EQ(journal.getRecordCount(), 2);
+    EXPECT_EQ(journal.getPendingRecordCount(), 0);
+    manager.deleteStudent(1000);
+    journal.close();
+    EXPECT_FALSE(std::filesystem::exists(testFilePath + ".tmp"));
+    
+    Journal reopened(testFilePath);
+    StudentManager restored;
+    restored.addStudent("John Doe", "john.doe@example.com", 20);
+    EXPECT_EQ(reopened.replay(restored), 3);
+    EXPECT_EQ(restored.getStudent(1000), nullptr);
+    ASSERT_NE(restored.getStudent(1001), nullptr);
+    EXPECT_TRUE(restored.getStudent(1001)->isEnrolledIn("Physics"));
+}
+
+// Test replaying a missing or foreign file
+TEST_F(JournalTest, ReplayInvalidFile) {
+    Journal journal(testFilePath);
+    StudentManager manager;
+    EXPECT_EQ(journal.replay(manager), 0);
+    
+    std::ofstream(testFilePath) << "1001,John Doe,john.doe@example.com,20\n";
+    ::testing::internal::CaptureStderr();
+    EXPECT_EQ(journal.replay(manager), 0);
+    ::testing::internal::GetCapturedStderr();
+    EXPECT_EQ(manager.getStudentCount(), 0);
+}
+
+// Test that EveryOperation makes each mutation durable before it returns
+TEST_F(JournalTest, EveryOperationPolicy) {
+    Journal journal(testFilePath);
+    ASSERT_TRUE(journal.open());
+    DurabilityPolicy policy;
+    policy.mode = DurabilityPolicy::Mode::EveryOperation;
+    journal.setDurabilityPolicy(policy);
+    
+    StudentManager manager;
+    manager.setJournal(&journal);
+    manager.addStudent("John Doe", "john.doe@example.com", 20);
+    EXPECT_EQ(journal.getPendingRecordCount(), 0);
+    manager.enrollStudentInCourse(1000, "CS101");
+    EXPECT_EQ(journal.getPendingRecordCount(), 0);
+    
+    JournalStats stats = journal.getStats();
+    EXPECT_EQ(stats.recordsCommitted, 2);
+    EXPECT_EQ(stats.syncCount, 2);
+    EXPECT_EQ(stats.failedCommits, 0);
+    EXPECT_EQ(stats.batchSizeHistogram[0], 2);
+    
+    // Durable records are visible to a second reader without closing
+    Journal reader(testFilePath);
+    StudentManager restored;
+    EXPECT_EQ(reader.replay(restored), 2);
+}
+
+// Test that a mutation whose required commit fails reports it
+TEST_F(JournalTest, FailedCommitIsReported) {
+    if (!std::filesystem::exists("/dev/full")) {
+        GTEST_SKIP() << "needs /dev/full to make writes fail";
+    }
+    ::testing::internal::CaptureStderr();
+    {
+        Journal journal("/dev/full");
+        ASSERT_TRUE(journal.open());
+        DurabilityPolicy policy;
+        policy.mode = DurabilityPolicy::Mode::EveryOperation;
+        journal.setDurabilityPolicy(policy);
+        
+        StudentManager manager;
+        manager.setJournal(&journal);
+        EXPECT_FALSE(manager.addStudent("John Doe", "john.doe@example.com", 20));
+        EXPECT_FALSE(manager.enrollStudentInCourse(1000, "CS101"));
+        EXPECT_FALSE(manager.removeStudentFromCourse(1000, "CS101"));
+        EXPECT_FALSE(manager.deleteStudent(1000));
+        EXPECT_EQ(journal.getStats().failedCommits, 4);
+        
+        // The changes themselves were made in memory
+        EXPECT_EQ(manager.getStudent(1000), nullptr);
+        EXPECT_EQ(manager.getStudentCount(), 0);
+        manager.setJournal(nullptr);
+    }
+    EXPECT_NE(::testing::internal::GetCapturedStderr().find("Error:"), std::string::npos);
+}
+
+// Test that OperationCount commits once the batch is full
+TEST_F(JournalTest, OperationCountPolicy) {
+    Journal journal(testFilePath);
+    ASSERT_TRUE(journal.open());
+    DurabilityPolicy policy;
+    policy.mode = DurabilityPolicy::Mode::OperationCount;
+    policy.operationCount = 4;
+    journal.setDurabilityPolicy(policy);
+    
+    StudentManager manager;
+    manager.setJournal(&journal);
+    for (int i = 0; i < 3; ++i) {
+        manager.addStudent("Student " + std::to_string(i), "s@example.com", 20);
+    }
+    EXPECT_EQ(journal.getPendingRecordCount(), 3);
+    EXPECT_EQ(journal.getStats().commitCount, 0);
+    
+    manager.addStudent("Student 3", "s@example.com", 20);
+    EXPECT_EQ(journal.getPendingRecordCount(), 0);
+    JournalStats stats = journal.getStats();
+    EXPECT_EQ(stats.commitCount, 1);
+    EXPECT_EQ(stats.maxBatchRecords, 4);
+    EXPECT_EQ(stats.batchSizeHistogram[2], 1);
+    EXPECT_DOUBLE_EQ(stats.averageBatchRecords(), 4.0);
+}
+
+// Test that OsManaged writes records without fsync
+TEST_F(JournalTest, OsManagedPolicy) {
+    Journal journal(testFilePath);
+    ASSERT_TRUE(journal.open());
+    DurabilityPolicy policy;
+    policy.mode = DurabilityPolicy::Mode::OsManaged;
+    journal.setDurabilityPolicy(policy);
+    
+    StudentManager manager;
+    manager.setJournal(&journal);
+    manager.addStudent("John Doe", "john.doe@example.com", 20);
+    manager.deleteStudent(1000);
+    
+    EXPECT_EQ(journal.getPendingRecordCount(), 0);
+    EXPECT_EQ(journal.getStats().syncCount, 0);
+    
+    Journal reader(testFilePath);
+    StudentManager restored;
+    EXPECT_EQ(reader.replay(restored), 2);
+    
+    // An explicit sync only has to fsync what was already written
+    ASSERT_TRUE(journal.sync());
+    EXPECT_EQ(journal.getStats().syncCount, 1);
+}
+
+// Test that the Interval flusher commits in the background
+TEST_F(JournalTest, IntervalPolicy) {
+    Journal journal(testFilePath);
+    DurabilityPolicy policy;
+    policy.mode = DurabilityPolicy::Mode::Interval;
+    policy.intervalMs = 10;
+    journal.setDurabilityPolicy(policy);
+    ASSERT_TRUE(journal.open());
+    
+    StudentManager manager;
+    manager.setJournal(&journal);
+    manager.addStudent("John Doe", "john.doe@example.com", 20);
+    
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (journal.getPendingRecordCount() != 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(journal.getPendingRecordCount(), 0);
+    EXPECT_GE(journal.getStats().syncCount, 1);
+    
+    // Switching back to Manual stops the flusher
+    journal.setDurabilityPolicy(DurabilityPolicy());
+    manager.addStudent("Jane Smith", "jane.smith@example.com", 22);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(journal.getPendingRecordCount(), 1);
+}
+
+// Test that concurrent writers share commits and every record reaches the file
+TEST_F(JournalTest, GroupCommitConcurrentWriters) {
+    const int threadCount = 8;
+    const int recordsPerThread = 200;
+    {
+        Journal journal(testFilePath);
+        ASSERT_TRUE(journal.open());
+        DurabilityPolicy policy;
+        policy.mode = DurabilityPolicy::Mode::EveryOperation;
+        journal.setDurabilityPolicy(policy);
+        
+        std::vector<std::thread> writers;
+        for (int t = 0; t < threadCount; ++t) {
+            writers.emplace_back([&journal, t] {
+                for (int i = 0; i < recordsPerThread; ++i) {
+                    uint32_t id = static_cast<uint32_t>(1000 + t * recordsPerThread + i);
+                    Student student(static_cast<int>(id), "Student", "s@example.com", 20);
+                    EXPECT_TRUE(journal.commitPerPolicy(journal.recordAddStudent(student)));
+                }
+            });
+        }
+        for (auto& writer : writers) {
+            writer.join();
+        }
+        
+        JournalStats stats = journal.getStats();
+        EXPECT_EQ(stats.recordsCommitted, threadCount * recordsPerThread);
+        EXPECT_LE(stats.syncCount, stats.recordsCommitted);
+        EXPECT_EQ(stats.failedCommits, 0);
+        uint64_t histogramTotal = 0;
+        for (uint64_t bucket : stats.batchSizeHistogram) {
+            histogramTotal += bucket;
+        }
+        EXPECT_EQ(histogramTotal, stats.commitCount);
+        EXPECT_GT(stats.averageCommitMicros(), 0.0);
+    }
+    
+    Journal journal(testFilePath);
+    StudentManager restored;
+    EXPECT_EQ(journal.replay(restored), threadCount * recordsPerThread);
+    EXPECT_EQ(restored.getStudentCount(), threadCount * recordsPerThread);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
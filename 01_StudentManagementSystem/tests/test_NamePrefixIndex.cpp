@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+#include "NamePrefixIndex.h"
+
+// Test fixture for NamePrefixIndex class
+class NamePrefixIndexTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        index.add(1000, "John Doe");
+        index.add(1001, "Jane Smith");
+        index.add(1002, "johanna Berg");
+        index.add(1003, "John Doe");
+    }
+
+    NamePrefixIndex index;
+};
+
+// Test that matches come back ordered by folded name, then ID
+TEST_F(NamePrefixIndexTest, FindOrdersByNameThenId) {
+    EXPECT_EQ(index.find("jo", 10), (std::vector<uint32_t>{1002, 1000, 1003}));
+    EXPECT_EQ(index.find("john doe", 10), (std::vector<uint32_t>{1000, 1003}));
+    EXPECT_EQ(index.find("j", 10), (std::vector<uint32_t>{1001, 1002, 1000, 1003}));
+    EXPECT_TRUE(index.find("doe", 10).empty());
+    EXPECT_TRUE(index.find("john doe jr", 10).empty());
+}
+
+// Test that the limit caps the number of results
+TEST_F(NamePrefixIndexTest, Limit) {
+    EXPECT_EQ(index.find("j", 2), (std::vector<uint32_t>{1001, 1002}));
+    EXPECT_TRUE(index.find("j", 0).empty());
+    EXPECT_EQ(index.find("", 10).size(), 4);
+}
+
+// Test removing entries
+TEST_F(NamePrefixIndexTest, Remove) {
+    index.remove(1000, "John Doe");
+    EXPECT_EQ(index.find("john", 10), (std::vector<uint32_t>{1003}));
+    EXPECT_EQ(index.size(), 3);
+    
+    // Removing an entry that is not indexed is harmless
+    index.remove(1001, "Someone Else");
+    EXPECT_EQ(index.size(), 3);
+    
+    index.clear();
+    EXPECT_EQ(index.size(), 0);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
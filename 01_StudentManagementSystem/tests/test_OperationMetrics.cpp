@@ -0,0 +1,177 @@
+#include <gtest/gtest.h>
+#include "OperationMetrics.h"
+#include "FileManager.h"
+#include "StudentManager.h"
+#include <cstdio>  // for remove()
+#include <string>
+#include <thread>
+#include <vector>
+
+// Test fixture for OperationMetrics class
+class OperationMetricsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        OperationMetrics::reset();
+        // One file per test, so tests run in parallel by ctest do not clash
+        const std::string testName = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        testFilePath = "test_operation_metrics_" + testName + ".csv";
+    }
+
+    void TearDown() override {
+        std::remove(testFilePath.c_str());
+        std::remove((testFilePath + ".snap").c_str());
+    }
+
+    std::string testFilePath;
+};
+
+// Test that every value lands in a bucket whose bound is within 1/16 of it
+TEST_F(OperationMetricsTest, HistogramBuckets) {
+    for (uint64_t value : {0ULL, 1ULL, 15ULL, 16ULL, 31ULL, 32ULL, 1000ULL, 123456789ULL, 1ULL << 43}) {
+        size_t bucket = LatencyHistogram::bucketFor(value);
+        ASSERT_LT(bucket, LatencyHistogram::BUCKET_COUNT);
+        uint64_t bound = LatencyHistogram::bucketUpperBound(bucket);
+        EXPECT_GE(bound, value);
+        EXPECT_LE(bound - value, value / 16);
+        if (bucket > 0) {
+            EXPECT_LT(LatencyHistogram::bucketUpperBound(bucket - 1), value);
+        }
+    }
+    EXPECT_EQ(LatencyHistogram::bucketFor(~0ULL), LatencyHistogram::BUCKET_COUNT - 1);
+}
+
+// Test counts, extremes and percentiles of a histogram
+TEST_F(OperationMetricsTest, HistogramPercentiles) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.getPercentile(50), 0);
+    for (uint64_t value = 1; value <= 1000; ++value) {
+        histogram.record(value * 1000);
+    }
+    EXPECT_EQ(histogram.getCount(), 1000);
+    EXPECT_EQ(histogram.getMin(), 1000);
+    EXPECT_EQ(histogram.getMax(), 1000000);
+    EXPECT_DOUBLE_EQ(histogram.getMean(), 500500.0);
+    EXPECT_NEAR(static_cast<double>(histogram.getPercentile(50)), 500000.0, 500000.0 / 16);
+    EXPECT_NEAR(static_cast<double>(histogram.getPercentile(99)), 990000.0, 990000.0 / 16);
+    EXPECT_EQ(histogram.getPercentile(100), 1000000);
+    EXPECT_GE(histogram.getPercentile(0), 1000);
+    EXPECT_LE(histogram.getPercentile(0), 1000 + 1000 / 16);
+
+    LatencyHistogram other;
+    other.record(5);
+    histogram.merge(other);
+    EXPECT_EQ(histogram.getCount(), 1001);
+    EXPECT_EQ(histogram.getMin(), 5);
+    histogram.clear();
+    EXPECT_EQ(histogram.getCount(), 0);
+}
+
+#if defined(SMS_ENABLE_METRICS)
+
+// Test that StudentManager operations are counted and sampled
+TEST_F(OperationMetricsTest, CountsManagerOperations) {
+    StudentManager manager;
+    for (int i = 0; i < 100; ++i) {
+        manager.addStudent("Student " + std::to_string(i), "s@example.com", 20);
+    }
+    for (uint32_t id = 1000; id < 1100; ++id) {
+        manager.getStudent(id);
+        manager.enrollStudentInCourse(id, "Math");
+    }
+    manager.findStudent(1000);
+    manager.searchStudentsByName("student 1");
+    manager.removeStudentFromCourse(1000, "Math");
+    manager.deleteStudent(1001);
+    manager.getAllStudents();
+
+    MetricsReport report = StudentManager::getStats();
+    EXPECT_EQ(report.get(Operation::AddStudent).calls, 100);
+    EXPECT_EQ(report.get(Operation::GetStudent).calls, 101);
+    EXPECT_EQ(report.get(Operation::EnrollInCourse).calls, 100);
+    EXPECT_EQ(report.get(Operation::SearchStudents).calls, 1);
+    EXPECT_EQ(report.get(Operation::RemoveFromCourse).calls, 1);
+    EXPECT_EQ(report.get(Operation::DeleteStudent).calls, 1);
+    EXPECT_EQ(report.get(Operation::GetAllStudents).calls, 1);
+    EXPECT_EQ(report.get(Operation::SaveStudents).calls, 0);
+
+    // The first call of every operation is timed, then one in (mask + 1)
+    EXPECT_EQ(report.get(Operation::AddStudent).latency.getCount(), 100 / 8 + 1);
+    EXPECT_EQ(report.get(Operation::GetStudent).latency.getCount(), 1);
+    EXPECT_EQ(report.get(Operation::EnrollInCourse).latency.getCount(), 100 / 64 + 1);
+    EXPECT_EQ(report.get(Operation::GetAllStudents).latency.getCount(), 1);
+    EXPECT_GT(report.get(Operation::GetAllStudents).latency.getMax(), 0);
+
+    OperationMetrics::reset();
+    EXPECT_EQ(StudentManager::getStats().get(Operation::AddStudent).calls, 0);
+}
+
+// Test that load and save phases are counted once per call
+TEST_F(OperationMetricsTest, CountsFileOperations) {
+    StudentManager manager;
+    manager.addStudent("John Doe", "john.doe@example.com", 20);
+    manager.setSnapshotsEnabled(true);
+    FileManager fileManager(testFilePath);
+    fileManager.saveStudents(manager);
+    fileManager.saveSnapshot(manager);
+
+    StudentManager loaded;
+    loaded.bulkLoadStudents(fileManager.loadStudents());
+    fileManager.loadSnapshot();
+
+    MetricsReport report = StudentManager::getStats();
+    EXPECT_EQ(report.get(Operation::SaveStudents).calls, 1);
+    EXPECT_EQ(report.get(Operation::SaveSnapshot).calls, 1);
+    EXPECT_EQ(report.get(Operation::LoadStudents).calls, 1);
+    EXPECT_EQ(report.get(Operation::LoadSnapshot).calls, 1);
+    EXPECT_EQ(report.get(Operation::BulkLoadStudents).calls, 1);
+    EXPECT_EQ(report.get(Operation::LoadStudents).latency.getCount(), 1);
+}
+
+// Test that the buffers of other threads, running or exited, are summed
+TEST_F(OperationMetricsTest, SumsThreads) {
+    StudentManager manager;
+    manager.addStudent("John Doe", "john.doe@example.com", 20);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&manager] {
+            for (int i = 0; i < 1000; ++i) {
+                manager.findStudent(1000);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    manager.findStudent(1000);
+
+    MetricsReport report = OperationMetrics::collect();
+    EXPECT_EQ(report.get(Operation::GetStudent).calls, 4001);
+    EXPECT_EQ(report.get(Operation::GetStudent).latency.getCount(), 4 + 1);
+}
+
+#endif
+
+// Test the text and JSON reports
+TEST_F(OperationMetricsTest, Reports) {
+    MetricsReport report;
+    report.get(Operation::SearchStudents).calls = 3;
+    report.get(Operation::SearchStudents).latency.record(2500);
+
+    std::string text = report.toText();
+    EXPECT_NE(text.find("operation"), std::string::npos);
+    EXPECT_NE(text.find("p99_us"), std::string::npos);
+    EXPECT_NE(text.find("searchStudents"), std::string::npos);
+    EXPECT_NE(text.find("2.50"), std::string::npos);
+
+    std::string json = report.toJson();
+    EXPECT_EQ(json.front(), '{');
+    EXPECT_EQ(json.back(), '}');
+    EXPECT_NE(json.find("\"searchStudents\":{\"calls\":3,\"sampled\":1,\"min_ns\":2500"), std::string::npos);
+    EXPECT_NE(json.find("\"saveSnapshot\":{\"calls\":0"), std::string::npos);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
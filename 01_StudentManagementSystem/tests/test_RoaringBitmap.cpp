@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include "RoaringBitmap.h"
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+#include <vector>
+
+// Test fixture for RoaringBitmap class
+class RoaringBitmapTest : public ::testing::Test {
+protected:
+    // Fill a bitmap and a reference set with count random values below limit
+    static void fill(RoaringBitmap& bitmap, std::set<uint32_t>& reference, size_t count, uint32_t limit,
+                     uint32_t seed) {
+        std::mt19937 rng(seed);
+        for (size_t i = 0; i < count; ++i) {
+            uint32_t value = rng() % limit;
+            EXPECT_EQ(bitmap.add(value), reference.insert(value).second);
+        }
+    }
+
+    static std::vector<uint32_t> toVector(const std::set<uint32_t>& values) {
+        return std::vector<uint32_t>(values.begin(), values.end());
+    }
+};
+
+// Test adding, finding and removing single values
+TEST_F(RoaringBitmapTest, AddContainsRemove) {
+    RoaringBitmap bitmap;
+    EXPECT_TRUE(bitmap.empty());
+    EXPECT_TRUE(bitmap.add(5));
+    EXPECT_TRUE(bitmap.add(70000));
+    EXPECT_TRUE(bitmap.add(0xFFFFFFFF));
+    EXPECT_FALSE(bitmap.add(5));
+    EXPECT_TRUE(bitmap.contains(70000));
+    EXPECT_FALSE(bitmap.contains(6));
+    EXPECT_EQ(bitmap.cardinality(), 3);
+    EXPECT_EQ(bitmap.toVector(), (std::vector<uint32_t>{5, 70000, 0xFFFFFFFF}));
+
+    EXPECT_TRUE(bitmap.remove(70000));
+    EXPECT_FALSE(bitmap.remove(70000));
+    EXPECT_FALSE(bitmap.contains(70000));
+    EXPECT_EQ(bitmap.cardinality(), 2);
+    bitmap.clear();
+    EXPECT_TRUE(bitmap.empty());
+}
+
+// Test that containers switch between array and bitmap form without losing values
+TEST_F(RoaringBitmapTest, ContainerConversion) {
+    RoaringBitmap bitmap;
+    std::set<uint32_t> reference;
+    fill(bitmap, reference, 20000, 65536, 1);
+    EXPECT_EQ(bitmap.cardinality(), reference.size());
+    EXPECT_EQ(bitmap.toVector(), toVector(reference));
+
+    // Removing most values turns the container back into an array
+    std::mt19937 rng(2);
+    for (int i = 0; i < 60000; ++i) {
+        uint32_t value = rng() % 65536;
+        EXPECT_EQ(bitmap.remove(value), reference.erase(value) > 0);
+    }
+    EXPECT_EQ(bitmap.toVector(), toVector(reference));
+
+    RoaringBitmap rebuilt;
+    for (uint32_t value : reference) {
+        rebuilt.add(value);
+    }
+    EXPECT_TRUE(bitmap == rebuilt);
+}
+
+// Test set operations against std::set algorithms, for sparse and dense sets
+TEST_F(RoaringBitmapTest, SetAlgebraMatchesReference) {
+    for (uint32_t limit : {1000000u, 200000u, 70000u}) {
+        for (size_t count : {1000u, 50000u}) {
+            RoaringBitmap a, b;
+            std::set<uint32_t> setA, setB;
+            fill(a, setA, count, limit, static_cast<uint32_t>(limit + count));
+            fill(b, setB, count / 2, limit, static_cast<uint32_t>(limit + count + 1));
+
+            std::vector<uint32_t> expected;
+            RoaringBitmap result = a;
+            result &= b;
+            std::set_intersection(setA.begin(), setA.end(), setB.begin(), setB.end(),
+                                  std::back_inserter(expected));
+            EXPECT_EQ(result.toVector(), expected);
+            EXPECT_EQ(result.cardinality(), expected.size());
+
+            expected.clear();
+            result = a;
+            result |= b;
+            std::set_union(setA.begin(), setA.end(), setB.begin(), setB.end(), std::back_inserter(expected));
+            EXPECT_EQ(result.toVector(), expected);
+            EXPECT_EQ(result.cardinality(), expected.size());
+
+            expected.clear();
+            result = a;
+            result -= b;
+            std::set_difference(setA.begin(), setA.end(), setB.begin(), setB.end(),
+                                std::back_inserter(expected));
+            EXPECT_EQ(result.toVector(), expected);
+            EXPECT_EQ(result.cardinality(), expected.size());
+
+            expected.clear();
+            result = b;
+            result -= a;
+            std::set_difference(setB.begin(), setB.end(), setA.begin(), setA.end(),
+                                std::back_inserter(expected));
+            EXPECT_EQ(result.toVector(), expected);
+        }
+    }
+}
+
+// Test operations with empty sets and with the set itself
+TEST_F(RoaringBitmapTest, EdgeCases) {
+    RoaringBitmap a, empty;
+    std::set<uint32_t> reference;
+    fill(a, reference, 10000, 100000, 3);
+
+    RoaringBitmap result = a;
+    result &= empty;
+    EXPECT_TRUE(result.empty());
+    result = a;
+    result |= empty;
+    EXPECT_TRUE(result == a);
+    result -= empty;
+    EXPECT_TRUE(result == a);
+    result -= a;
+    EXPECT_TRUE(result.empty());
+    result = a;
+    result &= a;
+    EXPECT_TRUE(result == a);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
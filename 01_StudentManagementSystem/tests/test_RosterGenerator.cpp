@@ -0,0 +1,196 @@
+#include <gtest/gtest.h>
+#include "RosterGenerator.h"
+#include "FileManager.h"
+#include <cstdio>  // for remove()
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Test fixture for RosterGenerator class
+class RosterGeneratorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // One file per test, so tests run in parallel by ctest do not clash
+        const std::string testName = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        testFilePath = "test_roster_generator_" + testName + ".csv";
+        options.records = 2000;
+        options.seed = 42;
+    }
+
+    void TearDown() override {
+        std::remove(testFilePath.c_str());
+        std::remove((testFilePath + ".tmp").c_str());
+    }
+
+    static std::string readFile(const std::string& path) {
+        std::ifstream inFile(path, std::ios::binary);
+        std::stringstream contents;
+        contents << inFile.rdbuf();
+        return contents.str();
+    }
+
+    std::string testFilePath;
+    RosterOptions options;
+};
+
+// Test that a seed always gives the same students and another seed different ones
+TEST_F(RosterGeneratorTest, Deterministic) {
+    RosterGenerator first(options);
+    RosterGenerator second(options);
+    for (uint64_t index : {0, 1, 777, 1999}) {
+        EXPECT_EQ(first.makeStudent(index).toString(), second.makeStudent(index).toString());
+    }
+
+    options.seed = 43;
+    RosterGenerator reseeded(options);
+    int differing = 0;
+    for (uint64_t index = 0; index < 100; ++index) {
+        differing += first.makeStudent(index).toString() != reseeded.makeStudent(index).toString();
+    }
+    EXPECT_GT(differing, 90);
+}
+
+// Test that generated students respect the configured ranges
+TEST_F(RosterGeneratorTest, RespectsOptions) {
+    options.firstId = 5000;
+    options.minNameLength = 10;
+    options.maxNameLength = 12;
+    options.minCourses = 2;
+    options.maxCourses = 4;
+    options.courseCatalogSize = 30;
+    options.minAge = 18;
+    options.maxAge = 21;
+    RosterGenerator generator(options);
+
+    std::vector<Student> students = generator.makeStudents();
+    ASSERT_EQ(students.size(), 2000);
+    std::set<std::string> emails;
+    for (size_t i = 0; i < students.size(); ++i) {
+        const Student& student = students[i];
+        EXPECT_EQ(student.getStudentId(), static_cast<int>(5000 + i));
+        EXPECT_GE(student.getName().size(), 10);
+        EXPECT_LE(student.getName().size(), 12);
+        EXPECT_EQ(student.getName().find(','), std::string::npos);
+        EXPECT_GE(student.getAge(), 18);
+        EXPECT_LE(student.getAge(), 21);
+        size_t courses = student.getCourses().size();
+        EXPECT_GE(courses, 2);
+        EXPECT_LE(courses, 4);
+        emails.insert(student.getEmail());
+    }
+    EXPECT_EQ(emails.size(), students.size());
+}
+
+// Test that popular courses are taken far more often than unpopular ones
+TEST_F(RosterGeneratorTest, ZipfCoursePopularity) {
+    options.minCourses = 1;
+    options.maxCourses = 1;
+    options.courseCatalogSize = 100;
+    options.courseZipfExponent = 1.2;
+    RosterGenerator generator(options);
+
+    std::vector<Student> students = generator.makeStudents();
+    auto takers = [&students](const std::string& course) {
+        size_t count = 0;
+        for (const Student& student : students) {
+            count += student.isEnrolledIn(course);
+        }
+        return count;
+    };
+    size_t top = takers(generator.getCourseName(0));
+    EXPECT_GT(top, takers(generator.getCourseName(9)) * 5);
+    EXPECT_GT(top, students.size() / 5);
+
+    options.courseZipfExponent = 0;
+    RosterGenerator uniform(options);
+    students = uniform.makeStudents();
+    EXPECT_LT(takers(uniform.getCourseName(0)), students.size() / 20);
+}
+
+// Test that asking for every course of a small catalogue still terminates
+TEST_F(RosterGeneratorTest, AllCoursesOfCatalogue) {
+    options.minCourses = 5;
+    options.maxCourses = 5;
+    options.courseCatalogSize = 5;
+    options.courseZipfExponent = 4.0;
+    RosterGenerator generator(options);
+    EXPECT_EQ(generator.makeStudent(3).getCourses().size(), 5);
+}
+
+// Test that the written file loads back through FileManager
+TEST_F(RosterGeneratorTest, WriteFileLoadsBack) {
+    RosterGenerator generator(options);
+    ASSERT_TRUE(generator.writeFile(testFilePath));
+
+    FileManager fileManager(testFilePath);
+    std::vector<Student> loaded = fileManager.loadStudents();
+    ASSERT_EQ(loaded.size(), 2000);
+    for (uint64_t index : {0, 1, 1000, 1999}) {
+        EXPECT_EQ(loaded[index].toString(), generator.makeStudent(index).toString());
+    }
+}
+
+// Test that the file is byte for byte the same with any number of threads
+TEST_F(RosterGeneratorTest, ThreadCountDoesNotChangeFile) {
+    options.records = RosterGenerator::RECORDS_PER_BLOCK * 3 + 123;
+    RosterGenerator generator(options);
+
+    ASSERT_TRUE(generator.writeFile(testFilePath, 1));
+    std::string single = readFile(testFilePath);
+    ASSERT_TRUE(generator.writeFile(testFilePath, 4));
+    EXPECT_EQ(readFile(testFilePath), single);
+
+    std::ostringstream expected;
+    for (uint64_t index = 0; index < 10; ++index) {
+        FileManager::writeCsvRecord(expected, generator.makeStudent(index));
+    }
+    EXPECT_EQ(single.compare(0, expected.str().size(), expected.str()), 0);
+}
+
+// Test an empty roster and an unwritable path
+TEST_F(RosterGeneratorTest, EmptyRosterAndUnwritablePath) {
+    options.records = 0;
+    RosterGenerator generator(options);
+    ASSERT_TRUE(generator.writeFile(testFilePath, 4));
+    EXPECT_TRUE(readFile(testFilePath).empty());
+
+    ::testing::internal::CaptureStderr();
+    EXPECT_FALSE(generator.writeFile("no_such_directory/roster.csv"));
+    EXPECT_NE(::testing::internal::GetCapturedStderr().find("Error:"), std::string::npos);
+}
+
+// Test that invalid ranges are rejected
+TEST_F(RosterGeneratorTest, InvalidOptions) {
+    RosterOptions bad = options;
+    bad.minNameLength = 4;
+    EXPECT_THROW(RosterGenerator{bad}, std::invalid_argument);
+
+    bad = options;
+    bad.minCourses = 3;
+    bad.maxCourses = 2;
+    EXPECT_THROW(RosterGenerator{bad}, std::invalid_argument);
+
+    bad = options;
+    bad.maxCourses = 201;
+    EXPECT_THROW(RosterGenerator{bad}, std::invalid_argument);
+
+    bad = options;
+    bad.maxAge = 300;
+    EXPECT_THROW(RosterGenerator{bad}, std::invalid_argument);
+
+    bad = options;
+    bad.courseZipfExponent = -1;
+    EXPECT_THROW(RosterGenerator{bad}, std::invalid_argument);
+
+    bad = options;
+    bad.firstId = 0x7FFFFFFF;
+    EXPECT_THROW(RosterGenerator{bad}, std::invalid_argument);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+#include "ShardedStudentManager.h"
+#include <string>
+#include <thread>
+#include <vector>
+
+// Test fixture for ShardedStudentManager class
+class ShardedStudentManagerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // The same students in a sharded and a plain manager
+        const char* names[] = {"John Doe", "Jane Smith", "Bob Johnson", "Alice Brown", "Johanna Doe",
+                               "Ann Smith", "Annabel Lee", "Joe Brown", "Mary Johnson", "Jon Lee"};
+        for (int i = 0; i < 40; ++i) {
+            std::string name = std::string(names[i % 10]) + " " + std::to_string(i);
+            uint8_t age = static_cast<uint8_t>(18 + i % 7);
+            sharded.addStudent(name, "s@example.com", age);
+            plain.addStudent(name, "s@example.com", age);
+        }
+        for (uint32_t id = 1000; id < 1040; id += 3) {
+            sharded.enrollStudentInCourse(id, "Math");
+            plain.enrollStudentInCourse(id, "Math");
+        }
+        for (uint32_t id = 1000; id < 1040; id += 4) {
+            sharded.enrollStudentInCourse(id, "Physics");
+            plain.enrollStudentInCourse(id, "Physics");
+        }
+    }
+
+    static std::vector<int> ids(const std::vector<Student*>& students) {
+        std::vector<int> result;
+        for (const Student* student : students) {
+            result.push_back(student->getStudentId());
+        }
+        return result;
+    }
+
+    ShardedStudentManager sharded{4};
+    StudentManager plain;
+};
+
+// Test that IDs are handed out like StudentManager's and spread over the shards
+TEST_F(ShardedStudentManagerTest, AddAndLookup) {
+    EXPECT_EQ(sharded.getShardCount(), 4);
+    EXPECT_EQ(sharded.getStudentCount(), 40);
+
+    Student* student = sharded.getStudent(1003);
+    ASSERT_NE(student, nullptr);
+    EXPECT_EQ(student->getName(), "Alice Brown 3");
+    std::optional<Student> copy = sharded.findStudent(1039);
+    ASSERT_TRUE(copy.has_value());
+    EXPECT_EQ(copy->getName(), "Jon Lee 39");
+    EXPECT_FALSE(sharded.findStudent(1040).has_value());
+
+    EXPECT_TRUE(sharded.addStudent("New Student", "new@example.com", 30));
+    EXPECT_NE(sharded.getStudent(1040), nullptr);
+}
+
+// Test that fan-out queries give the same results as a single manager
+TEST_F(ShardedStudentManagerTest, FanOutMatchesStudentManager) {
+    for (const char* query : {"john", "Doe", "an", "Lee 3", "xyz", ""}) {
+        EXPECT_EQ(ids(sharded.searchStudentsByName(query)), ids(plain.searchStudentsByName(query))) << query;
+        EXPECT_EQ(sharded.findStudentsByName(query).size(), plain.findStudentsByName(query).size()) << query;
+    }
+    for (const char* prefix : {"jo", "ann", "a", "z"}) {
+        EXPECT_EQ(ids(sharded.searchStudentsByNamePrefix(prefix, 5)), ids(plain.searchStudentsByNamePrefix(prefix, 5)))
+            << prefix;
+    }
+
+    EXPECT_EQ(ids(sharded.getStudentsInCourse("Math")), ids(plain.getStudentsInCourse("Math")));
+    EXPECT_EQ(sharded.getCourseEnrollmentCount("Physics"), plain.getCourseEnrollmentCount("Physics"));
+
+    CourseQuery query;
+    query.anyOf = {"Math", "Physics"};
+    query.noneOf = {"Physics"};
+    EXPECT_EQ(sharded.findStudentIdsByCourses(query), plain.findStudentIdsByCourses(query));
+    EXPECT_EQ(sharded.countStudentsByCourses(query), plain.countStudentsByCourses(query));
+
+    EXPECT_EQ(sharded.findStudentIdsByAgeRange(19, 21), plain.findStudentIdsByAgeRange(19, 21));
+    EXPECT_EQ(sharded.countStudentsByAgeRange(20, 20), plain.countStudentsByAgeRange(20, 20));
+    EXPECT_EQ(sharded.findStudentIdsByIdRange(1005, 1012), plain.findStudentIdsByIdRange(1005, 1012));
+
+    std::vector<Student> all = sharded.getAllStudents();
+    ASSERT_EQ(all.size(), 40);
+    for (size_t i = 0; i < all.size(); ++i) {
+        EXPECT_EQ(all[i].getStudentId(), static_cast<int>(1000 + i));
+    }
+
+    size_t visited = 0;
+    sharded.forEachStudent([&visited](const Student&) { visited++; });
+    EXPECT_EQ(visited, 40);
+}
+
+// Test deletes, course removal and the columnar copy through the shards
+TEST_F(ShardedStudentManagerTest, Mutations) {
+    EXPECT_TRUE(sharded.deleteStudent(1003));
+    EXPECT_FALSE(sharded.deleteStudent(1003));
+    EXPECT_EQ(sharded.getStudentCount(), 39);
+    EXPECT_EQ(sharded.getCourseEnrollmentCount("Math"), 13);
+
+    EXPECT_TRUE(sharded.removeStudentFromCourse(1000, "Math"));
+    EXPECT_FALSE(sharded.removeStudentFromCourse(1001, "Math"));
+    EXPECT_FALSE(sharded.enrollStudentInCourse(5000, "Math"));
+    EXPECT_EQ(sharded.getCourseEnrollmentCount("Math"), 12);
+
+    sharded.setColumnarStoreEnabled(true);
+    EXPECT_TRUE(sharded.isColumnarStoreEnabled());
+    plain.deleteStudent(1003);
+    EXPECT_EQ(sharded.findStudentIdsByAgeRange(18, 20), plain.findStudentIdsByAgeRange(18, 20));
+}
+
+// Test that bulk loading keeps IDs and moves the ID counter past them
+TEST_F(ShardedStudentManagerTest, BulkLoad) {
+    std::vector<Student> loaded;
+    loaded.push_back(Student(5002, "Loaded One", "l@example.com", 20));
+    loaded.push_back(Student(5001, "Loaded Two", "l@example.com", 21));
+    EXPECT_EQ(sharded.bulkLoadStudents(std::move(loaded)), 2);
+    EXPECT_TRUE(loaded.empty());
+    EXPECT_EQ(sharded.getStudentCount(), 42);
+
+    sharded.addStudent("After Load", "a@example.com", 22);
+    ASSERT_NE(sharded.getStudent(5003), nullptr);
+    EXPECT_EQ(sharded.getStudent(5003)->getName(), "After Load");
+}
+
+// Test that writers on several threads get distinct IDs and lose no updates
+TEST(ShardedStudentManagerConcurrencyTest, ConcurrentWriters) {
+    ShardedStudentManager manager(4);
+    const int threadCount = 8;
+    const int addsPerThread = 250;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&manager, t] {
+            for (int i = 0; i < addsPerThread; ++i) {
+                manager.addStudent("Thread" + std::to_string(t) + " Student", "t@example.com", 20);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Enroll every student, each thread taking an interleaved slice of the IDs
+    threads.clear();
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&manager, t] {
+            for (int i = t; i < threadCount * addsPerThread; i += threadCount) {
+                EXPECT_TRUE(manager.enrollStudentInCourse(1000 + static_cast<uint32_t>(i), "Shared"));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(manager.getStudentCount(), threadCount * addsPerThread);
+    EXPECT_EQ(manager.getCourseEnrollmentCount("Shared"), static_cast<size_t>(threadCount * addsPerThread));
+    std::vector<uint32_t> ids = manager.findStudentIdsByIdRange(0, 0xFFFFFFFF);
+    ASSERT_EQ(ids.size(), static_cast<size_t>(threadCount * addsPerThread));
+    EXPECT_EQ(ids.front(), 1000);
+    EXPECT_EQ(ids.back(), static_cast<uint32_t>(1000 + threadCount * addsPerThread - 1));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include "Snapshot.h"
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <cstdio>  // for remove()
+
+// Test fixture for the snapshot format
+class SnapshotTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // One file per test, so tests run in parallel by ctest do not clash
+        const std::string testName = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        testFilePath = "test_snapshot_" + testName + ".snap";
+        
+        // Deliberately out of ID order with shared course names
+        testStudents.push_back(Student(1003, "Bob Johnson", "bob.johnson@example.com", 19));
+        testStudents.push_back(Student(1001, "John Doe", "john.doe@example.com", 20));
+        testStudents.push_back(Student(1002, "Jane Smith", "jane.smith@example.com", 22));
+        testStudents[0].addCourse("CS101");
+        testStudents[1].addCourse("CS101");
+        testStudents[1].addCourse("MATH202");
+    }
+
+    void TearDown() override {
+        std::remove(testFilePath.c_str());
+    }
+
+    std::vector<char> readFile() const {
+        std::ifstream inFile(testFilePath, std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(inFile), std::istreambuf_iterator<char>());
+    }
+
+    std::string testFilePath;
+    std::vector<Student> testStudents;
+};
+
+// Test writing and reading back a snapshot
+TEST_F(SnapshotTest, WriteAndView) {
+    ASSERT_TRUE(writeSnapshot(testFilePath, testStudents));
+    std::vector<char> bytes = readFile();
+    
+    SnapshotView view;
+    ASSERT_TRUE(view.attach(bytes.data(), bytes.size()));
+    ASSERT_EQ(view.size(), 3);
+    
+    // Records are sorted by ID
+    EXPECT_EQ(view.record(0).studentId, 1001);
+    EXPECT_EQ(view.record(1).studentId, 1002);
+    EXPECT_EQ(view.record(2).studentId, 1003);
+    
+    EXPECT_EQ(view.name(0), "John Doe");
+    EXPECT_EQ(view.email(0), "john.doe@example.com");
+    EXPECT_EQ(view.record(0).age, 20);
+    ASSERT_EQ(view.record(0).courseCount, 2);
+    EXPECT_EQ(view.course(0, 0), "CS101");
+    EXPECT_EQ(view.course(0, 1), "MATH202");
+    EXPECT_EQ(view.record(1).courseCount, 0);
+    
+    // Course names are stored once
+    SnapshotHeader header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    EXPECT_EQ(header.courseCount, 2);
+    EXPECT_EQ(header.courseRefCount, 3);
+}
+
+// Test finding and materializing records
+TEST_F(SnapshotTest, FindAndMaterialize) {
+    ASSERT_TRUE(writeSnapshot(testFilePath, testStudents));
+    std::vector<char> bytes = readFile();
+    SnapshotView view;
+    ASSERT_TRUE(view.attach(bytes.data(), bytes.size()));
+    
+    size_t index = view.find(1003);
+    ASSERT_LT(index, view.size());
+    Student student = view.materialize(index);
+    EXPECT_EQ(student.getStudentId(), 1003);
+    EXPECT_EQ(student.getName(), "Bob Johnson");
+    EXPECT_EQ(student.getAge(), 19);
+    EXPECT_TRUE(student.isEnrolledIn("CS101"));
+    
+    EXPECT_EQ(view.find(999), view.size());
+    EXPECT_EQ(view.find(1004), view.size());
+}
+
+// Test an empty roster
+TEST_F(SnapshotTest, EmptySnapshot) {
+    ASSERT_TRUE(writeSnapshot(testFilePath, {}));
+    std::vector<char> bytes = readFile();
+    SnapshotView view;
+    ASSERT_TRUE(view.attach(bytes.data(), bytes.size()));
+    EXPECT_EQ(view.size(), 0);
+    EXPECT_EQ(view.find(1000), 0);
+}
+
+// Test invalid snapshots are rejected
+TEST_F(SnapshotTest, RejectsInvalidData) {
+    ASSERT_TRUE(writeSnapshot(testFilePath, testStudents));
+    std::vector<char> bytes = readFile();
+    SnapshotView view;
+    
+    // Too short
+    EXPECT_FALSE(view.attach(bytes.data(), sizeof(SnapshotHeader) - 1));
+    
+    // Truncated sections
+    EXPECT_FALSE(view.attach(bytes.data(), bytes.size() - 1));
+    
+    // Wrong magic
+    std::vector<char> badMagic = bytes;
+    badMagic[0] = 'X';
+    EXPECT_FALSE(view.attach(badMagic.data(), badMagic.size()));
+    
+    // Wrong version
+    std::vector<char> badVersion = bytes;
+    SnapshotHeader header;
+    std::memcpy(&header, badVersion.data(), sizeof(header));
+    header.version = SNAPSHOT_VERSION + 1;
+    std::memcpy(badVersion.data(), &header, sizeof(header));
+    EXPECT_FALSE(view.attach(badVersion.data(), badVersion.size()));
+    
+    // Record pointing outside the string table
+    std::vector<char> badRecord = bytes;
+    std::memcpy(&header, badRecord.data(), sizeof(header));
+    SnapshotRecord record;
+    std::memcpy(&record, badRecord.data() + header.recordOffset, sizeof(record));
+    record.nameOffset = header.stringTableSize;
+    record.nameLength = 1;
+    std::memcpy(badRecord.data() + header.recordOffset, &record, sizeof(record));
+    ASSERT_TRUE(view.attach(badRecord.data(), badRecord.size()));
+    EXPECT_THROW(view.name(0), std::out_of_range);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include "StringSearch.h"
+#include <algorithm>
+#include <cctype>
+#include <random>
+#include <string>
+
+// Test fixture running every test against each kernel the CPU supports
+class StringSearchTest : public ::testing::TestWithParam<StringSearchKernel> {
+protected:
+    void SetUp() override {
+        if (!isStringSearchKernelSupported(GetParam())) {
+            GTEST_SKIP() << "Kernel not supported on this CPU";
+        }
+    }
+
+    bool contains(const std::string& text, const std::string& pattern) const {
+        return containsIgnoreCase(text, pattern, GetParam());
+    }
+};
+
+// Reference: lowercase copies and std::string::find
+static bool referenceContains(std::string text, std::string pattern) {
+    auto lower = [](std::string& value) {
+        std::transform(value.begin(), value.end(), value.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    };
+    lower(text);
+    lower(pattern);
+    return text.find(pattern) != std::string::npos;
+}
+
+// Test simple matches and mismatches
+TEST_P(StringSearchTest, Basics) {
+    EXPECT_TRUE(contains("John Doe", "john"));
+    EXPECT_TRUE(contains("John Doe", "DOE"));
+    EXPECT_TRUE(contains("John Doe", "n D"));
+    EXPECT_TRUE(contains("John Doe", "John Doe"));
+    EXPECT_TRUE(contains("John Doe", ""));
+    EXPECT_TRUE(contains("", ""));
+    EXPECT_TRUE(contains("x", "X"));
+    EXPECT_FALSE(contains("John Doe", "Jane"));
+    EXPECT_FALSE(contains("John", "John Doe"));
+    EXPECT_FALSE(contains("", "a"));
+}
+
+// Test that only ASCII letters are folded
+TEST_P(StringSearchTest, OnlyAsciiLettersFold) {
+    EXPECT_FALSE(contains("a@b", "A`B"));
+    EXPECT_FALSE(contains("[x]", "{X}"));
+    EXPECT_TRUE(contains("Jos\xc3\xa9 Garc\xc3\xad" "a", "JOS\xc3\xa9"));
+    EXPECT_FALSE(contains("Jos\xc3\xa9", "JOS\xc3\x89"));
+}
+
+// Test matches at every offset across block boundaries
+TEST_P(StringSearchTest, EveryOffset) {
+    for (size_t length = 1; length <= 100; ++length) {
+        std::string text(length, 'x');
+        for (size_t patternLength = 1; patternLength <= std::min<size_t>(length, 40); patternLength += 3) {
+            for (size_t offset = 0; offset + patternLength <= length; ++offset) {
+                std::string haystack = text;
+                for (size_t i = 0; i < patternLength; ++i) {
+                    haystack[offset + i] = static_cast<char>('A' + i % 26);
+                }
+                std::string pattern = haystack.substr(offset, patternLength);
+                std::transform(pattern.begin(), pattern.end(), pattern.begin(), ::tolower);
+                ASSERT_TRUE(contains(haystack, pattern))
+                    << "length " << length << " offset " << offset << " pattern " << pattern;
+                // Changing the last byte of the pattern must break the match
+                pattern.back() = '#';
+                ASSERT_FALSE(contains(haystack, pattern));
+            }
+        }
+    }
+}
+
+// Test random inputs against the reference implementation
+TEST_P(StringSearchTest, MatchesReference) {
+    std::mt19937 rng(11);
+    const std::string alphabet = "abAB -\xc3\xa9";
+    auto randomString = [&](size_t length) {
+        std::string value(length, ' ');
+        for (char& c : value) {
+            c = alphabet[rng() % alphabet.size()];
+        }
+        return value;
+    };
+    for (int i = 0; i < 20000; ++i) {
+        std::string text = randomString(rng() % 80);
+        std::string pattern = randomString(1 + rng() % 6);
+        ASSERT_EQ(contains(text, pattern), referenceContains(text, pattern))
+            << "text '" << text << "' pattern '" << pattern << "'";
+    }
+}
+
+// Test inputs where nearly every position is a candidate
+TEST_P(StringSearchTest, Pathological) {
+    std::string text(10000, 'a');
+    EXPECT_FALSE(contains(text, std::string(50, 'a') + "b"));
+    text += "B";
+    EXPECT_TRUE(contains(text, std::string(50, 'A') + "b"));
+}
+
+INSTANTIATE_TEST_SUITE_P(Kernels, StringSearchTest,
+                         ::testing::Values(StringSearchKernel::Scalar, StringSearchKernel::Sse2,
+                                           StringSearchKernel::Avx2));
+
+// Test that the active kernel is supported
+TEST(StringSearchDispatchTest, ActiveKernelIsSupported) {
+    EXPECT_TRUE(isStringSearchKernelSupported(activeStringSearchKernel()));
+    EXPECT_TRUE(isStringSearchKernelSupported(StringSearchKernel::Scalar));
+    EXPECT_TRUE(containsIgnoreCase("Bob Johnson", "JOHN"));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "Student.h"
+#include <sstream>
 
 // Test fixture for Student class
 class StudentTest : public ::testing::Test {
@@ -83,6 +84,23 @@ TEST_F(StudentTest, ToStringMethod) {
     EXPECT_NE(result.find("Courses: CS101, MATH202"), std::string::npos);
 }
 
+// Test that streaming a student matches toString and reads fields in place
+TEST_F(StudentTest, StreamOperator) {
+    testStudent.addCourse("CS101");
+    testStudent.addCourse("MATH202");
+    std::ostringstream out;
+    out << testStudent;
+    EXPECT_EQ(out.str(), testStudent.toString());
+    
+    std::vector<std::string> courses;
+    testStudent.forEachCourse([&courses](const std::string& course) { courses.push_back(course); });
+    EXPECT_EQ(courses, testStudent.getCourses());
+    
+    // Accessors return references to the stored fields
+    EXPECT_EQ(&testStudent.getName(), &testStudent.getName());
+    EXPECT_EQ(&testStudent.getEmail(), &testStudent.getEmail());
+}
+
 // Test default constructor
 TEST(StudentDefaultConstructorTest, DefaultValues) {
     Student defaultStudent;
@@ -1,5 +1,12 @@
 #include <gtest/gtest.h>
 #include "StudentManager.h"
+#include <algorithm>
+#include <cctype>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <random>
+#include <thread>
 
 // Test fixture for StudentManager class
 class StudentManagerTest : public ::testing::Test {
@@ -149,12 +156,357 @@ TEST_F(StudentManagerTest, RemoveStudentFromCourse) {
     EXPECT_FALSE(result);
 }
 
+// Test type-ahead prefix search
+TEST_F(StudentManagerTest, SearchStudentsByNamePrefix) {
+    manager.addStudent("johanna Berg", "johanna.berg@example.com", 23);
+    
+    std::vector<Student*> students = manager.searchStudentsByNamePrefix("JO");
+    ASSERT_EQ(students.size(), 2);
+    EXPECT_EQ(students[0]->getName(), "johanna Berg");
+    EXPECT_EQ(students[1]->getName(), "John Doe");
+    
+    // Only the first name matches a prefix, not a later word
+    EXPECT_TRUE(manager.searchStudentsByNamePrefix("Smith").empty());
+    EXPECT_EQ(manager.searchStudentsByNamePrefix("j", 1).size(), 1);
+    
+    // The index follows deletions
+    manager.deleteStudent(students[1]->getStudentId());
+    EXPECT_EQ(manager.searchStudentsByNamePrefix("john").size(), 0);
+}
+
+// Test age and ID range filters with and without the columnar copy
+TEST_F(StudentManagerTest, RangeFilters) {
+    for (bool columnar : {false, true}) {
+        manager.setColumnarStoreEnabled(columnar);
+        EXPECT_EQ(manager.isColumnarStoreEnabled(), columnar);
+        EXPECT_EQ(manager.findStudentIdsByAgeRange(20, 22), (std::vector<uint32_t>{1000, 1001}));
+        EXPECT_EQ(manager.countStudentsByAgeRange(19, 19), 1);
+        EXPECT_EQ(manager.findStudentIdsByIdRange(1001, 1002), (std::vector<uint32_t>{1001, 1002}));
+    }
+    
+    // The columnar copy follows later mutations
+    manager.addStudent("Alice Brown", "alice.brown@example.com", 21);
+    manager.deleteStudent(1001);
+    EXPECT_EQ(manager.findStudentIdsByAgeRange(20, 22), (std::vector<uint32_t>{1000, 1003}));
+    manager.setColumnarStoreEnabled(false);
+    EXPECT_EQ(manager.findStudentIdsByAgeRange(20, 22), (std::vector<uint32_t>{1000, 1003}));
+}
+
+// Test listing and counting the students of a course
+TEST_F(StudentManagerTest, StudentsInCourse) {
+    manager.enrollStudentInCourse(1002, "CS101");
+    manager.enrollStudentInCourse(1000, "CS101");
+    manager.enrollStudentInCourse(1000, "CS101");
+    manager.enrollStudentInCourse(1001, "MATH202");
+    
+    std::vector<Student*> students = manager.getStudentsInCourse("CS101");
+    ASSERT_EQ(students.size(), 2);
+    EXPECT_EQ(students[0]->getStudentId(), 1000);
+    EXPECT_EQ(students[1]->getStudentId(), 1002);
+    EXPECT_EQ(manager.getCourseEnrollmentCount("CS101"), 2);
+    EXPECT_EQ(manager.getCourseEnrollmentCount("MATH202"), 1);
+    EXPECT_EQ(manager.getCourseEnrollmentCount("NO_SUCH_COURSE"), 0);
+    EXPECT_TRUE(manager.getStudentsInCourse("NO_SUCH_COURSE").empty());
+    
+    // The index follows removals and deletions
+    EXPECT_TRUE(manager.removeStudentFromCourse(1000, "CS101"));
+    EXPECT_FALSE(manager.removeStudentFromCourse(1000, "CS101"));
+    manager.deleteStudent(1001);
+    EXPECT_EQ(manager.getCourseEnrollmentCount("CS101"), 1);
+    EXPECT_EQ(manager.getCourseEnrollmentCount("MATH202"), 0);
+    
+    // Bulk loaded students are indexed, replaced ones are dropped
+    std::vector<Student> loaded;
+    loaded.push_back(Student(1002, "Bob Johnson", "bob.johnson@example.com", 19));
+    loaded.push_back(Student(1500, "Carol White", "carol@example.com", 23));
+    loaded[1].addCourse("CS101");
+    manager.bulkLoadStudents(std::move(loaded));
+    students = manager.getStudentsInCourse("CS101");
+    ASSERT_EQ(students.size(), 1);
+    EXPECT_EQ(students[0]->getStudentId(), 1500);
+}
+
+// Test AND / OR / AND NOT queries over courses
+TEST_F(StudentManagerTest, CourseQueries) {
+    manager.enrollStudentInCourse(1000, "CS101");
+    manager.enrollStudentInCourse(1000, "MATH202");
+    manager.enrollStudentInCourse(1001, "CS101");
+    manager.enrollStudentInCourse(1001, "PHYSICS101");
+    manager.enrollStudentInCourse(1002, "MATH202");
+    
+    CourseQuery query;
+    query.allOf = {"CS101", "MATH202"};
+    EXPECT_EQ(manager.findStudentIdsByCourses(query), (std::vector<uint32_t>{1000}));
+    
+    query.allOf = {"CS101"};
+    query.noneOf = {"MATH202"};
+    EXPECT_EQ(manager.findStudentIdsByCourses(query), (std::vector<uint32_t>{1001}));
+    
+    query = CourseQuery();
+    query.anyOf = {"PHYSICS101", "MATH202", "NO_SUCH_COURSE"};
+    EXPECT_EQ(manager.findStudentIdsByCourses(query), (std::vector<uint32_t>{1000, 1001, 1002}));
+    EXPECT_EQ(manager.countStudentsByCourses(query), 3);
+    
+    query.allOf = {"CS101"};
+    EXPECT_EQ(manager.findStudentIdsByCourses(query), (std::vector<uint32_t>{1000, 1001}));
+    query.allOf = {"CS101", "NO_SUCH_COURSE"};
+    EXPECT_TRUE(manager.findStudentIdsByCourses(query).empty());
+    
+    // Without allOf and anyOf every student is a candidate
+    query = CourseQuery();
+    query.noneOf = {"CS101"};
+    EXPECT_EQ(manager.findStudentIdsByCourses(query), (std::vector<uint32_t>{1002}));
+    EXPECT_EQ(manager.countStudentsByCourses(CourseQuery()), 3);
+}
+
 // Test getting all students
 TEST_F(StudentManagerTest, GetAllStudents) {
     std::vector<Student> allStudents = manager.getAllStudents();
     EXPECT_EQ(allStudents.size(), 3);
 }
 
+// Test visiting the stored students in ID order without copies
+TEST_F(StudentManagerTest, ForEachStudent) {
+    std::vector<uint32_t> ids;
+    manager.forEachStudent([&](const Student& student) {
+        ids.push_back(static_cast<uint32_t>(student.getStudentId()));
+        EXPECT_EQ(&student, manager.getStudent(static_cast<uint32_t>(student.getStudentId())));
+    });
+    EXPECT_EQ(ids, (std::vector<uint32_t>{1000, 1001, 1002}));
+}
+
+// Test that snapshots keep a point-in-time view while the manager changes
+TEST_F(StudentManagerTest, Snapshots) {
+    // Without versions a snapshot is a full copy
+    StudentSnapshot copied = manager.snapshot();
+    EXPECT_EQ(copied.size(), 3);
+    EXPECT_FALSE(manager.isSnapshotsEnabled());
+    
+    manager.setSnapshotsEnabled(true);
+    EXPECT_TRUE(manager.isSnapshotsEnabled());
+    StudentSnapshot before = manager.snapshot();
+    
+    manager.addStudent("Alice Brown", "alice.brown@example.com", 21);
+    manager.enrollStudentInCourse(1001, "Math");
+    manager.deleteStudent(1000);
+    
+    EXPECT_EQ(before.size(), 3);
+    ASSERT_NE(before.find(1000), nullptr);
+    EXPECT_FALSE(before.find(1001)->isEnrolledIn("Math"));
+    EXPECT_EQ(before.find(1003), nullptr);
+    
+    StudentSnapshot after = manager.snapshot();
+    EXPECT_EQ(after.size(), 3);
+    EXPECT_EQ(after.find(1000), nullptr);
+    EXPECT_TRUE(after.find(1001)->isEnrolledIn("Math"));
+    EXPECT_EQ(after.find(1003)->getName(), "Alice Brown");
+    EXPECT_EQ(copied.size(), 3);
+    
+    // Scans walk a snapshot, so the visitor may change the manager
+    std::vector<uint32_t> ids;
+    manager.forEachStudent([&](const Student& student) {
+        ids.push_back(static_cast<uint32_t>(student.getStudentId()));
+        manager.enrollStudentInCourse(static_cast<uint32_t>(student.getStudentId()), "Physics");
+    });
+    EXPECT_EQ(ids, (std::vector<uint32_t>{1001, 1002, 1003}));
+    EXPECT_EQ(manager.getCourseEnrollmentCount("Physics"), 3);
+    EXPECT_EQ(manager.getAllStudents().size(), 3);
+    
+    manager.setSnapshotsEnabled(false);
+    EXPECT_FALSE(manager.isSnapshotsEnabled());
+    EXPECT_EQ(after.size(), 3);
+}
+
+// Test that a long scan over a snapshot does not hold up writers
+TEST_F(StudentManagerTest, WritersDuringSnapshotScan) {
+    manager.setSnapshotsEnabled(true);
+    std::promise<void> written;
+    std::future<void> writtenFuture = written.get_future();
+    
+    std::thread writer;
+    size_t visited = 0;
+    manager.forEachStudent([&](const Student&) {
+        if (visited++ == 0) {
+            writer = std::thread([&] {
+                manager.addStudent("During Scan", "scan@example.com", 20);
+                manager.deleteStudent(1002);
+                written.set_value();
+            });
+            // The scan is still running, the writer must finish anyway
+            EXPECT_EQ(writtenFuture.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+        }
+    });
+    writer.join();
+    
+    EXPECT_EQ(visited, 3);
+    EXPECT_NE(manager.findStudent(1003), std::nullopt);
+    EXPECT_EQ(manager.findStudent(1002), std::nullopt);
+}
+
+// Test bulk loading students with their own IDs
+TEST(StudentManagerBulkLoadTest, BulkLoadStudents) {
+    StudentManager manager;
+    std::vector<Student> loaded;
+    loaded.push_back(Student(2005, "Carol White", "carol@example.com", 23));
+    loaded.push_back(Student(1500, "Dave Black", "dave@example.com", 24));
+    loaded[0].addCourse("CS101");
+    loaded[0].addCourse("MATH202");
+    
+    EXPECT_EQ(manager.bulkLoadStudents(std::move(loaded)), 2);
+    EXPECT_TRUE(loaded.empty());
+    EXPECT_EQ(manager.getStudentCount(), 2);
+    
+    // IDs and courses are preserved
+    Student* student = manager.getStudent(2005);
+    ASSERT_NE(student, nullptr);
+    EXPECT_EQ(student->getName(), "Carol White");
+    EXPECT_TRUE(student->isEnrolledIn("CS101"));
+    EXPECT_TRUE(student->isEnrolledIn("MATH202"));
+    ASSERT_NE(manager.getStudent(1500), nullptr);
+    
+    // Students come back in ID order
+    std::vector<Student> all = manager.getAllStudents();
+    ASSERT_EQ(all.size(), 2);
+    EXPECT_EQ(all[0].getStudentId(), 1500);
+    EXPECT_EQ(all[1].getStudentId(), 2005);
+    
+    // New students get an ID past the largest loaded one
+    manager.addStudent("Eve Green", "eve@example.com", 20);
+    std::vector<Student*> students = manager.searchStudentsByName("Eve");
+    ASSERT_EQ(students.size(), 1);
+    EXPECT_EQ(students[0]->getStudentId(), 2006);
+    
+    // A record with an existing ID replaces the stored student
+    std::vector<Student> update;
+    update.push_back(Student(1500, "Dave Updated", "dave@example.com", 25));
+    manager.bulkLoadStudents(std::move(update));
+    EXPECT_EQ(manager.getStudentCount(), 3);
+    EXPECT_EQ(manager.getStudent(1500)->getName(), "Dave Updated");
+    EXPECT_TRUE(manager.searchStudentsByName("Dave Black").empty());
+    EXPECT_EQ(manager.searchStudentsByName("updated").size(), 1);
+}
+
+// Reference implementation of the case-insensitive substring search
+static std::vector<int> scanByName(const StudentManager& manager, std::string query) {
+    auto lower = [](std::string text) {
+        std::transform(text.begin(), text.end(), text.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return text;
+    };
+    query = lower(query);
+    std::vector<int> ids;
+    for (const auto& student : manager.getAllStudents()) {
+        if (lower(student.getName()).find(query) != std::string::npos) {
+            ids.push_back(student.getStudentId());
+        }
+    }
+    return ids;
+}
+
+// Test that indexed name search matches a full scan after adds, deletes and bulk loads
+TEST(StudentManagerSearchTest, IndexedSearchMatchesScan) {
+    const char* first[] = {"John", "Jane", "Bob", "Alice", "Johanna", "Ann", "Annabel"};
+    const char* last[] = {"Doe", "Smith", "Johnson", "Brown", "Anderson", "DOE-SMITH"};
+    std::mt19937 rng(42);
+    auto pick = [&rng](auto& names) {
+        return std::string(names[rng() % (sizeof(names) / sizeof(names[0]))]);
+    };
+    
+    StudentManager manager;
+    for (int i = 0; i < 300; ++i) {
+        manager.addStudent(pick(first) + " " + pick(last), "s@example.com", 20);
+    }
+    for (uint32_t id = 1000; id < 1300; id += 7) {
+        manager.deleteStudent(id);
+    }
+    std::vector<Student> loaded;
+    for (int id = 1003; id < 1400; id += 5) {
+        loaded.push_back(Student(id, pick(first) + " " + pick(last), "s@example.com", 21));
+    }
+    manager.bulkLoadStudents(std::move(loaded));
+    
+    const char* queries[] = {"john", "JOHN", "ann", "Anna", "doe", "e-s", "n J",
+                             "son", "Alice Brown", "xyz", "jo", "", "Johanna Anderson"};
+    for (const char* query : queries) {
+        std::vector<int> found;
+        for (Student* student : manager.searchStudentsByName(query)) {
+            found.push_back(student->getStudentId());
+        }
+        EXPECT_EQ(found, scanByName(manager, query)) << "query: " << query;
+    }
+}
+
+// Test that readers, writers and enrollers can share a manager
+TEST(StudentManagerConcurrencyTest, ConcurrentReadersAndWriters) {
+    StudentManager manager;
+    for (int i = 0; i < 200; ++i) {
+        manager.addStudent("Base Student " + std::to_string(i), "base@example.com", 20);
+    }
+    
+    const int writerCount = 2;
+    const int addsPerWriter = 300;
+    std::atomic<bool> done(false);
+    std::atomic<int> badReads(0);
+    std::vector<std::thread> threads;
+    
+    for (int w = 0; w < writerCount; ++w) {
+        threads.emplace_back([&manager, w] {
+            for (int i = 0; i < addsPerWriter; ++i) {
+                manager.addStudent("Writer" + std::to_string(w) + " Student", "w@example.com", 21);
+                manager.enrollStudentInCourse(1000 + static_cast<uint32_t>(i % 200), "Course" + std::to_string(i % 5));
+                if (i % 10 == 0) {
+                    manager.deleteStudent(1000 + static_cast<uint32_t>(i % 200));
+                }
+            }
+        });
+    }
+    for (int r = 0; r < 3; ++r) {
+        threads.emplace_back([&manager, &done, &badReads, r] {
+            while (!done.load()) {
+                uint32_t id = 1000 + static_cast<uint32_t>(r * 61 % 200);
+                if (std::optional<Student> student = manager.findStudent(id)) {
+                    if (student->getStudentId() != static_cast<int>(id)) {
+                        badReads++;
+                    }
+                }
+                for (const Student& student : manager.findStudentsByName("writer0")) {
+                    if (student.getName() != "Writer0 Student") {
+                        badReads++;
+                    }
+                }
+                size_t enrolled = manager.getCourseEnrollmentCount("Course1");
+                if (enrolled > manager.getStudentCount()) {
+                    badReads++;
+                }
+                manager.findStudentIdsByAgeRange(21, 21);
+            }
+        });
+    }
+    
+    for (int w = 0; w < writerCount; ++w) {
+        threads[w].join();
+    }
+    done.store(true);
+    for (size_t t = writerCount; t < threads.size(); ++t) {
+        threads[t].join();
+    }
+    
+    EXPECT_EQ(badReads.load(), 0);
+    EXPECT_EQ(manager.findStudentsByName("writer").size(), static_cast<size_t>(writerCount * addsPerWriter));
+    std::vector<uint32_t> ids;
+    manager.forEachStudent([&ids](const Student& student) {
+        ids.push_back(static_cast<uint32_t>(student.getStudentId()));
+    });
+    EXPECT_EQ(ids.size(), manager.getStudentCount());
+    EXPECT_TRUE(std::adjacent_find(ids.begin(), ids.end()) == ids.end());
+    for (int c = 0; c < 5; ++c) {
+        std::string course = "Course" + std::to_string(c);
+        for (Student* student : manager.getStudentsInCourse(course)) {
+            EXPECT_TRUE(student->isEnrolledIn(course));
+        }
+    }
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
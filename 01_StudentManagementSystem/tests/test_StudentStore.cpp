@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+#include "StudentStore.h"
+#include <algorithm>
+#include <map>
+#include <random>
+#include <vector>
+
+// Typed test fixture running the same tests against every store
+template <typename Store>
+class StudentStoreTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        store.insertOrAssign(1000, Student(1000, "John Doe", "john.doe@example.com", 20));
+        store.insertOrAssign(1001, Student(1001, "Jane Smith", "jane.smith@example.com", 22));
+        store.insertOrAssign(1002, Student(1002, "Bob Johnson", "bob.johnson@example.com", 19));
+    }
+
+    std::vector<uint32_t> ids() const {
+        std::vector<uint32_t> result;
+        store.forEach([&result](const Student& student) {
+            result.push_back(static_cast<uint32_t>(student.getStudentId()));
+        });
+        return result;
+    }
+
+    Store store;
+};
+
+using StoreTypes = ::testing::Types<MapStudentStore, DenseStudentStore>;
+TYPED_TEST_SUITE(StudentStoreTest, StoreTypes);
+
+// Test finding, replacing and erasing students
+TYPED_TEST(StudentStoreTest, FindReplaceErase) {
+    EXPECT_EQ(this->store.size(), 3);
+    Student* student = this->store.find(1001);
+    ASSERT_NE(student, nullptr);
+    EXPECT_EQ(student->getName(), "Jane Smith");
+    EXPECT_EQ(this->store.find(999), nullptr);
+    EXPECT_EQ(this->store.find(1003), nullptr);
+    
+    // Replacing keeps the address and the count
+    this->store.insertOrAssign(1001, Student(1001, "Jane Updated", "jane@example.com", 23));
+    EXPECT_EQ(this->store.find(1001), student);
+    EXPECT_EQ(student->getName(), "Jane Updated");
+    EXPECT_EQ(this->store.size(), 3);
+    
+    EXPECT_TRUE(this->store.erase(1001));
+    EXPECT_FALSE(this->store.erase(1001));
+    EXPECT_EQ(this->store.find(1001), nullptr);
+    EXPECT_EQ(this->store.size(), 2);
+    
+    this->store.clear();
+    EXPECT_EQ(this->store.size(), 0);
+    EXPECT_TRUE(this->ids().empty());
+}
+
+// Test that IDs far from the others and below them are kept in order
+TYPED_TEST(StudentStoreTest, SparseIds) {
+    this->store.insertOrAssign(5000000, Student(5000000, "Far Away", "far@example.com", 30));
+    this->store.insertOrAssign(10, Student(10, "Early Bird", "early@example.com", 30));
+    this->store.insertOrAssign(990, Student(990, "Just Before", "before@example.com", 30));
+    this->store.insertOrAssign(1500, Student(1500, "Near By", "near@example.com", 30));
+    
+    EXPECT_EQ(this->ids(), (std::vector<uint32_t>{10, 990, 1000, 1001, 1002, 1500, 5000000}));
+    ASSERT_NE(this->store.find(5000000), nullptr);
+    EXPECT_EQ(this->store.find(10)->getName(), "Early Bird");
+    
+    // Erasing the ends of the range keeps the rest reachable
+    EXPECT_TRUE(this->store.erase(990));
+    EXPECT_TRUE(this->store.erase(1500));
+    EXPECT_EQ(this->ids(), (std::vector<uint32_t>{10, 1000, 1001, 1002, 5000000}));
+    EXPECT_EQ(this->store.find(1002)->getName(), "Bob Johnson");
+}
+
+// Test that pointers stay valid while other students are inserted and erased
+TYPED_TEST(StudentStoreTest, PointerStability) {
+    Student* john = this->store.find(1000);
+    for (uint32_t id = 1003; id < 20000; ++id) {
+        this->store.insertOrAssign(id, Student(static_cast<int>(id), "Filler", "f@example.com", 20));
+    }
+    for (uint32_t id = 999; id > 100; --id) {
+        this->store.insertOrAssign(id, Student(static_cast<int>(id), "Filler", "f@example.com", 20));
+    }
+    for (uint32_t id = 101; id < 999; ++id) {
+        this->store.erase(id);
+    }
+    EXPECT_EQ(this->store.find(1000), john);
+    EXPECT_EQ(john->getName(), "John Doe");
+}
+
+// Test random operations against a std::map reference
+TYPED_TEST(StudentStoreTest, MatchesReference) {
+    std::map<uint32_t, std::string> reference = {
+        {1000, "John Doe"}, {1001, "Jane Smith"}, {1002, "Bob Johnson"}};
+    std::mt19937 rng(7);
+    for (int step = 0; step < 20000; ++step) {
+        uint32_t id = (rng() % 8 == 0) ? static_cast<uint32_t>(rng()) : 900 + rng() % 3000;
+        if (rng() % 3 == 0) {
+            EXPECT_EQ(this->store.erase(id), reference.erase(id) > 0);
+        } else {
+            std::string name = "Student " + std::to_string(step);
+            this->store.insertOrAssign(id, Student(static_cast<int>(id), name, "s@example.com", 20));
+            reference[id] = name;
+        }
+    }
+    
+    EXPECT_EQ(this->store.size(), reference.size());
+    std::vector<uint32_t> expected;
+    for (const auto& pair : reference) {
+        expected.push_back(pair.first);
+        const Student* student = this->store.find(pair.first);
+        ASSERT_NE(student, nullptr);
+        EXPECT_EQ(student->getName(), pair.second);
+    }
+    EXPECT_EQ(this->ids(), expected);
+}
+
+// Test a store holding every 8th ID, as a shard does
+TYPED_TEST(StudentStoreTest, StridedIds) {
+    TypeParam store(8);
+    for (uint32_t id = 1003; id < 1003 + 8 * 100; id += 8) {
+        store.insertOrAssign(id, Student(id, "Student", "s@example.com", 20));
+    }
+    // IDs off the stride and far away still work
+    store.insertOrAssign(1004, Student(1004, "Off", "s@example.com", 20));
+    store.insertOrAssign(995, Student(995, "Before", "s@example.com", 20));
+    store.insertOrAssign(900000, Student(900000, "Far", "s@example.com", 20));
+    EXPECT_EQ(store.size(), 103u);
+
+    ASSERT_NE(store.find(1011), nullptr);
+    EXPECT_EQ(store.find(1011)->getStudentId(), 1011);
+    EXPECT_EQ(store.find(1012), nullptr);
+    EXPECT_EQ(store.find(1004)->getName(), "Off");
+    EXPECT_EQ(store.find(995)->getName(), "Before");
+    EXPECT_EQ(store.find(900000)->getName(), "Far");
+
+    EXPECT_TRUE(store.erase(995));
+    EXPECT_TRUE(store.erase(1003));
+    EXPECT_FALSE(store.erase(1003));
+    EXPECT_NE(store.find(1011), nullptr);
+
+    std::vector<uint32_t> ids;
+    store.forEach([&ids](const Student& student) {
+        ids.push_back(static_cast<uint32_t>(student.getStudentId()));
+    });
+    ASSERT_EQ(ids.size(), 101u);
+    EXPECT_TRUE(std::is_sorted(ids.begin(), ids.end()));
+    EXPECT_EQ(ids.front(), 1004u);
+    EXPECT_EQ(ids[1], 1011u);
+    EXPECT_EQ(ids.back(), 900000u);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+#include "Tracing.h"
+#include "DataHandler.h"
+#include "FileManager.h"
+#include "StudentManager.h"
+#include <cstdio>  // for remove()
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+// Test fixture for Tracer class
+class TracingTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // One file per test, so tests run in parallel by ctest do not clash
+        const std::string testName = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        tracePath = "test_tracing_" + testName + ".json";
+        dataPath = "test_tracing_" + testName + ".csv";
+        Tracer::stop();
+    }
+
+    void TearDown() override {
+        Tracer::stop();
+        std::remove(tracePath.c_str());
+        std::remove(dataPath.c_str());
+    }
+
+    static std::string readFile(const std::string& path) {
+        std::ifstream inFile(path, std::ios::binary);
+        std::stringstream contents;
+        contents << inFile.rdbuf();
+        return contents.str();
+    }
+
+    static size_t countSpans(const std::string& trace, const std::string& name) {
+        const std::string key = "\"name\":\"" + name + "\"";
+        size_t count = 0;
+        for (size_t at = trace.find(key); at != std::string::npos; at = trace.find(key, at + 1)) {
+            ++count;
+        }
+        return count;
+    }
+
+    std::string tracePath;
+    std::string dataPath;
+};
+
+// Test that spans are not recorded while tracing is off
+TEST_F(TracingTest, DisabledByDefault) {
+    EXPECT_FALSE(Tracer::isEnabled());
+    {
+        TraceSpan span("ignored");
+    }
+    EXPECT_FALSE(Tracer::stop());
+
+    ASSERT_TRUE(Tracer::start(tracePath));
+    EXPECT_TRUE(Tracer::isEnabled());
+    EXPECT_FALSE(Tracer::start(tracePath));
+    ASSERT_TRUE(Tracer::stop());
+    EXPECT_FALSE(Tracer::isEnabled());
+    EXPECT_EQ(countSpans(readFile(tracePath), "ignored"), 0);
+}
+
+// Test the Chrome trace-event format of nested spans
+TEST_F(TracingTest, WritesCompleteEvents) {
+    ASSERT_TRUE(Tracer::start(tracePath));
+    {
+        TraceSpan outer("outer");
+        outer.setArg("records", 42);
+        TraceSpan inner("inner");
+    }
+    ASSERT_TRUE(Tracer::stop());
+
+    std::string trace = readFile(tracePath);
+    EXPECT_EQ(trace.rfind("{\"traceEvents\":[", 0), 0);
+    EXPECT_NE(trace.find("\"droppedEvents\":0}}"), std::string::npos);
+    EXPECT_EQ(countSpans(trace, "outer"), 1);
+    EXPECT_EQ(countSpans(trace, "inner"), 1);
+    EXPECT_NE(trace.find("\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(trace.find("\"args\":{\"records\":42}"), std::string::npos);
+
+    // The inner span ends first and lies within the outer one
+    size_t innerAt = trace.find("\"name\":\"inner\"");
+    size_t outerAt = trace.find("\"name\":\"outer\"");
+    ASSERT_LT(innerAt, outerAt);
+    double innerStart = std::stod(trace.substr(trace.find("\"ts\":", innerAt) + 5));
+    double outerStart = std::stod(trace.substr(trace.find("\"ts\":", outerAt) + 5));
+    double innerDuration = std::stod(trace.substr(trace.find("\"dur\":", innerAt) + 6));
+    double outerDuration = std::stod(trace.substr(trace.find("\"dur\":", outerAt) + 6));
+    EXPECT_GE(outerStart, 0.0);
+    EXPECT_GE(innerStart, outerStart);
+    EXPECT_LE(innerStart + innerDuration, outerStart + outerDuration + 0.001);
+}
+
+// Test that a new session does not repeat the spans of the previous one
+TEST_F(TracingTest, SessionsAreSeparate) {
+    ASSERT_TRUE(Tracer::start(tracePath));
+    {
+        TraceSpan span("first");
+    }
+    ASSERT_TRUE(Tracer::stop());
+
+    ASSERT_TRUE(Tracer::start(tracePath));
+    {
+        TraceSpan span("second");
+    }
+    ASSERT_TRUE(Tracer::stop());
+
+    std::string trace = readFile(tracePath);
+    EXPECT_EQ(countSpans(trace, "first"), 0);
+    EXPECT_EQ(countSpans(trace, "second"), 1);
+}
+
+// Test that spans of threads that exited before stop() are written
+TEST_F(TracingTest, KeepsSpansOfExitedThreads) {
+    ASSERT_TRUE(Tracer::start(tracePath));
+    for (int t = 0; t < 3; ++t) {
+        std::thread worker([] {
+            TraceSpan span("worker");
+        });
+        worker.join();
+    }
+    {
+        TraceSpan span("main");
+    }
+    ASSERT_TRUE(Tracer::stop());
+
+    std::string trace = readFile(tracePath);
+    EXPECT_EQ(countSpans(trace, "worker"), 3);
+    size_t mainAt = trace.find("\"name\":\"main\"");
+    ASSERT_NE(mainAt, std::string::npos);
+    std::string mainTid = trace.substr(trace.find("\"tid\":", mainAt), 8);
+    size_t workerAt = trace.find("\"name\":\"worker\"");
+    EXPECT_NE(trace.substr(trace.find("\"tid\":", workerAt), 8), mainTid);
+}
+
+// Test the spans of saving, loading and searching
+TEST_F(TracingTest, TracesLoadSaveAndSearch) {
+    StudentManager manager;
+    manager.addStudent("John Doe", "john.doe@example.com", 20);
+    manager.addStudent("Jane Smith", "jane.smith@example.com", 22);
+    manager.enrollStudentInCourse(1000, "Math");
+    FileManager fileManager(dataPath);
+
+    ASSERT_TRUE(Tracer::start(tracePath));
+    testing::internal::CaptureStdout();
+    saveData(manager, fileManager);
+    StudentManager loaded;
+    loadData(loaded, fileManager);
+    testing::internal::GetCapturedStdout();
+    EXPECT_EQ(loaded.searchStudentsByName("Smith").size(), 1);
+    EXPECT_EQ(loaded.searchStudentsByName("o").size(), 1);
+    ASSERT_TRUE(Tracer::stop());
+
+    std::string trace = readFile(tracePath);
+    for (const char* name : {"saveData", "saveStudents", "writeRecords", "closeFile", "renameFile",
+                             "loadData", "loadStudents", "readBlock", "parseBlock",
+                             "bulkLoadStudents", "insertStudents", "nameIndexCandidates",
+                             "verifyCandidates", "scanNames"}) {
+        EXPECT_EQ(countSpans(trace, name), 1) << name;
+    }
+    EXPECT_EQ(countSpans(trace, "searchStudentsByName"), 2);
+    EXPECT_NE(trace.find("\"args\":{\"records\":2}"), std::string::npos);
+    EXPECT_NE(trace.find("\"args\":{\"matches\":1}"), std::string::npos);
+}
+
+// Test that an unwritable trace file is reported
+TEST_F(TracingTest, UnwritablePath) {
+    ASSERT_TRUE(Tracer::start("no_such_directory/trace.json"));
+    ::testing::internal::CaptureStderr();
+    EXPECT_FALSE(Tracer::stop());
+    EXPECT_NE(::testing::internal::GetCapturedStderr().find("Error:"), std::string::npos);
+    EXPECT_FALSE(Tracer::isEnabled());
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
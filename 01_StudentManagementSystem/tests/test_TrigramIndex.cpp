@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include "TrigramIndex.h"
+
+// Test fixture for TrigramIndex class
+class TrigramIndexTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        index.add(1000, "John Doe");
+        index.add(1001, "Jane Smith");
+        index.add(1002, "Bob Johnson");
+    }
+
+    TrigramIndex index;
+};
+
+// Test case folding
+TEST_F(TrigramIndexTest, Fold) {
+    EXPECT_EQ(TrigramIndex::fold("John DOE-42"), "john doe-42");
+    EXPECT_EQ(TrigramIndex::fold(""), "");
+}
+
+// Test which queries can be narrowed by the index
+TEST_F(TrigramIndexTest, CanNarrow) {
+    EXPECT_FALSE(TrigramIndex::canNarrow(""));
+    EXPECT_FALSE(TrigramIndex::canNarrow("jo"));
+    EXPECT_TRUE(TrigramIndex::canNarrow("joh"));
+}
+
+// Test that candidates contain every trigram of the query, in ID order
+TEST_F(TrigramIndexTest, Candidates) {
+    EXPECT_EQ(index.candidates("joh"), (std::vector<uint32_t>{1000, 1002}));
+    EXPECT_EQ(index.candidates("john"), (std::vector<uint32_t>{1000, 1002}));
+    EXPECT_EQ(index.candidates("smith"), (std::vector<uint32_t>{1001}));
+    EXPECT_TRUE(index.candidates("xyz").empty());
+    
+    // Candidates are a superset: both trigrams occur, but not next to each other
+    index.add(1003, "abcxbcd");
+    EXPECT_EQ(index.candidates("abcd"), (std::vector<uint32_t>{1003}));
+}
+
+// Test adding out of order and removing names
+TEST_F(TrigramIndexTest, AddAndRemove) {
+    index.add(900, "Johnny");
+    EXPECT_EQ(index.candidates("john"), (std::vector<uint32_t>{900, 1000, 1002}));
+    
+    index.remove(1000, "John Doe");
+    EXPECT_EQ(index.candidates("john"), (std::vector<uint32_t>{900, 1002}));
+    EXPECT_TRUE(index.candidates("doe").empty());
+    
+    // Removing a name that was never indexed is harmless
+    index.remove(5000, "Nobody");
+    
+    index.clear();
+    EXPECT_EQ(index.getTrigramCount(), 0);
+    EXPECT_TRUE(index.candidates("john").empty());
+}
+
+// Test that repeated trigrams in one name are indexed once
+TEST_F(TrigramIndexTest, RepeatedTrigrams) {
+    TrigramIndex single;
+    single.add(1, "aaaaaa");
+    EXPECT_EQ(single.getTrigramCount(), 1);
+    EXPECT_EQ(single.candidates("aaaa"), (std::vector<uint32_t>{1}));
+    single.remove(1, "aaaaaa");
+    EXPECT_EQ(single.getTrigramCount(), 0);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+#include "VersionedStudentStore.h"
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Test fixture for VersionedStudentStore class
+class VersionedStudentStoreTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        store.upsert(Student(1000, "John Doe", "john.doe@example.com", 20));
+        store.upsert(Student(1001, "Jane Smith", "jane.smith@example.com", 22));
+        store.upsert(Student(1002, "Bob Johnson", "bob.johnson@example.com", 19));
+    }
+
+    static std::vector<int> ids(const StudentSnapshot& view) {
+        std::vector<int> result;
+        view.forEach([&result](const Student& student) { result.push_back(student.getStudentId()); });
+        return result;
+    }
+
+    VersionedStudentStore store;
+};
+
+// Test lookups and ordered iteration
+TEST_F(VersionedStudentStoreTest, FindAndIterate) {
+    StudentSnapshot view = store.snapshot();
+    EXPECT_EQ(view.size(), 3);
+    EXPECT_FALSE(view.empty());
+    ASSERT_NE(view.find(1001), nullptr);
+    EXPECT_EQ(view.find(1001)->getName(), "Jane Smith");
+    EXPECT_EQ(view.find(999), nullptr);
+    EXPECT_EQ(view.find(0xFFFFFFFF), nullptr);
+    EXPECT_EQ(ids(view), (std::vector<int>{1000, 1001, 1002}));
+
+    StudentSnapshot empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.find(1000), nullptr);
+    EXPECT_TRUE(ids(empty).empty());
+}
+
+// Test that a snapshot keeps its version while the store changes
+TEST_F(VersionedStudentStoreTest, SnapshotIsolation) {
+    StudentSnapshot before = store.snapshot();
+
+    Student changed(1001, "Jane Smith", "jane.smith@example.com", 23);
+    changed.addCourse("Math");
+    store.upsert(changed);
+    EXPECT_TRUE(store.erase(1000));
+    EXPECT_FALSE(store.erase(1000));
+    store.upsert(Student(1003, "Alice Brown", "alice.brown@example.com", 21));
+
+    EXPECT_EQ(ids(before), (std::vector<int>{1000, 1001, 1002}));
+    EXPECT_EQ(before.find(1001)->getAge(), 22);
+    EXPECT_TRUE(before.find(1001)->getCourses().empty());
+
+    StudentSnapshot after = store.snapshot();
+    EXPECT_EQ(ids(after), (std::vector<int>{1001, 1002, 1003}));
+    EXPECT_EQ(after.find(1001)->getAge(), 23);
+    EXPECT_TRUE(after.find(1001)->isEnrolledIn("Math"));
+    EXPECT_EQ(store.size(), 3);
+
+    // Unchanged students are shared between the versions
+    EXPECT_EQ(before.find(1002), after.find(1002));
+}
+
+// Test that clear leaves existing snapshots alone
+TEST_F(VersionedStudentStoreTest, Clear) {
+    StudentSnapshot before = store.snapshot();
+    store.clear();
+    EXPECT_EQ(store.size(), 0);
+    EXPECT_TRUE(store.snapshot().empty());
+    EXPECT_EQ(before.size(), 3);
+
+    store.upsert(Student(5, "Low Id", "low@example.com", 20));
+    EXPECT_EQ(ids(store.snapshot()), (std::vector<int>{5}));
+}
+
+// Test many versions of random IDs against a std::map model
+TEST_F(VersionedStudentStoreTest, MatchesModelAcrossVersions) {
+    std::mt19937 rng(7);
+    std::map<uint32_t, int> model;
+    store.clear();
+    std::vector<std::pair<StudentSnapshot, std::map<uint32_t, int>>> versions;
+
+    for (int step = 0; step < 3000; ++step) {
+        uint32_t id = (rng() % 4 == 0) ? rng() : 1000 + rng() % 5000;
+        if (rng() % 3 == 0) {
+            EXPECT_EQ(store.erase(id), model.erase(id) == 1);
+        } else {
+            int age = static_cast<int>(rng() % 100);
+            store.upsert(Student(static_cast<int>(id), "S", "s@example.com", static_cast<uint8_t>(age)));
+            model[id] = age;
+        }
+        if (step % 300 == 0) {
+            versions.emplace_back(store.snapshot(), model);
+        }
+    }
+    versions.emplace_back(store.snapshot(), model);
+
+    for (const auto& version : versions) {
+        const StudentSnapshot& view = version.first;
+        const std::map<uint32_t, int>& expected = version.second;
+        ASSERT_EQ(view.size(), expected.size());
+        auto it = expected.begin();
+        view.forEach([&it](const Student& student) {
+            EXPECT_EQ(static_cast<uint32_t>(student.getStudentId()), it->first);
+            EXPECT_EQ(student.getAge(), it->second);
+            ++it;
+        });
+        for (const auto& entry : expected) {
+            ASSERT_NE(view.find(entry.first), nullptr);
+        }
+    }
+}
+
+// Test that snapshots can be read and dropped on other threads while the owner writes
+TEST_F(VersionedStudentStoreTest, ReadersOnOtherThreads) {
+    for (int id = 1000; id < 3000; ++id) {
+        store.upsert(Student(id, "S", "s@example.com", 20));
+    }
+    std::vector<std::thread> readers;
+    for (int round = 0; round < 20; ++round) {
+        StudentSnapshot view = store.snapshot();
+        readers.emplace_back([view] {
+            size_t seen = 0;
+            view.forEach([&seen](const Student& student) {
+                EXPECT_EQ(student.getAge(), 20);
+                seen++;
+            });
+            EXPECT_EQ(seen, view.size());
+        });
+        for (int id = 1000 + round * 50; id < 1050 + round * 50; ++id) {
+            store.upsert(Student(id, "S", "s@example.com", 20));
+            store.erase(static_cast<uint32_t>(id + 1000));
+        }
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(store.size(), 2000 - 1000);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,163 @@
+#include "RosterGenerator.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace {
+
+/**
+ * @brief Print the command line options
+ */
+void printUsage() {
+    std::cout << "Usage: generate_students --output PATH [options]\n"
+              << "Writes a deterministic synthetic roster in the student data file format.\n\n"
+              << "  --output PATH          File to write\n"
+              << "  --records N            Number of students (default 1000)\n"
+              << "  --seed N               Random seed; the same seed gives the same file (default 1)\n"
+              << "  --first-id N           ID of the first student (default 1000)\n"
+              << "  --name-length MIN:MAX  Length of \"First Last\" names (default 8:24)\n"
+              << "  --courses MIN:MAX      Courses per student (default 0:6)\n"
+              << "  --catalog N            Number of distinct courses (default 200)\n"
+              << "  --zipf S               Course popularity skew, 0 is uniform (default 1.0)\n"
+              << "  --ages MIN:MAX         Student ages (default 17:30)\n"
+              << "  --threads N            Generator threads, 0 for one per core (default 0)\n"
+              << "  --help                 Show this message\n";
+}
+
+/**
+ * @brief Parse an unsigned integer option value
+ * @param text Option value
+ * @return The number
+ * @throws std::invalid_argument if text is not a whole non-negative number
+ */
+uint64_t parseCount(const std::string& text) {
+    size_t used = 0;
+    if (text.empty() || text[0] == '-') {
+        throw std::invalid_argument(text);
+    }
+    uint64_t value = std::stoull(text, &used);
+    if (used != text.size()) {
+        throw std::invalid_argument(text);
+    }
+    return value;
+}
+
+/**
+ * @brief Parse a MIN:MAX option value
+ * @param text Option value
+ * @param low Receives MIN
+ * @param high Receives MAX
+ * @throws std::invalid_argument if text is not two numbers separated by ':'
+ */
+void parseRange(const std::string& text, uint64_t& low, uint64_t& high) {
+    size_t colon = text.find(':');
+    if (colon == std::string::npos) {
+        throw std::invalid_argument(text);
+    }
+    low = parseCount(text.substr(0, colon));
+    high = parseCount(text.substr(colon + 1));
+}
+
+/**
+ * @brief Narrow a parsed number to 32 bits
+ * @param value Parsed number
+ * @return The number
+ * @throws std::out_of_range if it does not fit
+ */
+uint32_t toUint32(uint64_t value) {
+    if (value > UINT32_MAX) {
+        throw std::out_of_range(std::to_string(value));
+    }
+    return static_cast<uint32_t>(value);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    RosterOptions options;
+    std::string outputPath;
+    unsigned threads = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string option = argv[i];
+        if (option == "--help") {
+            printUsage();
+            return 0;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Error: Missing value for " << option << std::endl;
+            return 1;
+        }
+        std::string value = argv[++i];
+        try {
+            uint64_t low = 0;
+            uint64_t high = 0;
+            if (option == "--output") {
+                outputPath = value;
+            } else if (option == "--records") {
+                options.records = parseCount(value);
+            } else if (option == "--seed") {
+                options.seed = parseCount(value);
+            } else if (option == "--first-id") {
+                options.firstId = toUint32(parseCount(value));
+            } else if (option == "--name-length") {
+                parseRange(value, low, high);
+                options.minNameLength = toUint32(low);
+                options.maxNameLength = toUint32(high);
+            } else if (option == "--courses") {
+                parseRange(value, low, high);
+                options.minCourses = toUint32(low);
+                options.maxCourses = toUint32(high);
+            } else if (option == "--catalog") {
+                options.courseCatalogSize = toUint32(parseCount(value));
+            } else if (option == "--zipf") {
+                size_t used = 0;
+                options.courseZipfExponent = std::stod(value, &used);
+                if (used != value.size()) {
+                    throw std::invalid_argument(value);
+                }
+            } else if (option == "--ages") {
+                parseRange(value, low, high);
+                options.minAge = static_cast<int>(std::min<uint64_t>(low, 1000));
+                options.maxAge = static_cast<int>(std::min<uint64_t>(high, 1000));
+            } else if (option == "--threads") {
+                threads = toUint32(parseCount(value));
+            } else {
+                std::cerr << "Error: Unknown option " << option << std::endl;
+                printUsage();
+                return 1;
+            }
+        } catch (const std::exception&) {
+            std::cerr << "Error: Invalid value for " << option << ": " << value << std::endl;
+            return 1;
+        }
+    }
+
+    if (outputPath.empty()) {
+        std::cerr << "Error: --output is required" << std::endl;
+        printUsage();
+        return 1;
+    }
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    try {
+        RosterGenerator generator(options);
+        auto started = std::chrono::steady_clock::now();
+        if (!generator.writeFile(outputPath, threads)) {
+            return 1;
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+        std::cout << "Wrote " << options.records << " students to " << outputPath << " in "
+                  << seconds << " s using " << threads << " thread(s).\n";
+    } catch (const std::invalid_argument& error) {
+        std::cerr << "Error: Invalid options: " << error.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}